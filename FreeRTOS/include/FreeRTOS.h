@@ -349,6 +349,18 @@ extern "C" {
 	#define traceTASK_SWITCHED_IN()
 #endif
 
+#ifndef traceCRITICAL_ENTER
+	/* Called after a task level critical section has been entered, with
+	interrupts already masked. */
+	#define traceCRITICAL_ENTER()
+#endif
+
+#ifndef traceCRITICAL_EXIT
+	/* Called before a task level critical section is exited, with interrupts
+	still masked. */
+	#define traceCRITICAL_EXIT()
+#endif
+
 #ifndef traceINCREASE_TICK_COUNT
 	/* Called before stepping the tick count after waking from tickless idle
 	sleep. */
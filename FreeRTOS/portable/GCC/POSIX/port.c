@@ -0,0 +1,415 @@
+/*
+    FreeRTOS V9.0.0 - POSIX (Linux host) port.
+
+    Each task owns a POSIX thread and a wake semaphore. A context switch posts
+    the semaphore of the task selected by vTaskSwitchContext() and then waits
+    on the semaphore of the task that was switched out, so exactly one task
+    thread is runnable at any time.
+
+    Interrupt lines are real-time signals. They are blocked on every thread at
+    creation and only unblocked by the running task when it leaves its last
+    critical section, so a process-directed signal can only be taken by the
+    running task - which is exactly what an interrupt does on the hardware.
+    A context switch requested from an interrupt is deferred to the end of the
+    handler, like PendSV.
+
+    1 tab == 4 spaces!
+*/
+
+/*-----------------------------------------------------------
+ * Implementation of functions defined in portable.h for the POSIX port.
+ *----------------------------------------------------------*/
+
+#define _GNU_SOURCE
+#include <errno.h>
+#include <pthread.h>
+#include <semaphore.h>
+#include <signal.h>
+#include <string.h>
+#include <time.h>
+
+/* Scheduler includes. */
+#include "FreeRTOS.h"
+#include "task.h"
+
+/* Per-task thread bookkeeping, kept at the top of the task stack. */
+typedef struct THREAD
+{
+	pthread_t xHandle;
+	sem_t xWake;
+	TaskFunction_t pxCode;
+	void *pvParameters;
+	volatile BaseType_t xDying;
+} Thread_t;
+
+/* The TCB layout guarantees pxTopOfStack is the first member. */
+#define portTHREAD_OF( pxTCB )		( *( Thread_t ** ) ( pxTCB ) )
+
+extern void * volatile pxCurrentTCB;
+
+/* Each task maintains its own interrupt status in the critical nesting
+variable. It is saved around every switch by prvSwitchThread(). */
+static volatile UBaseType_t uxCriticalNesting = 0xaaaaaaaa;
+
+/* Set by vPortYieldFromISR(), consumed at the end of the interrupt. */
+static volatile BaseType_t xSwitchPending = pdFALSE;
+
+/* The emulated interrupt controller. */
+static sigset_t xInterruptSignals;
+static void ( * volatile pxInterruptHandlers[ portMAX_INTERRUPTS ] )( void );
+static timer_t xTickTimer;
+static BaseType_t xTickTimerCreated = pdFALSE;
+
+/* Released by vPortEndScheduler() to return from xPortStartScheduler(). */
+static sem_t xSchedulerEnd;
+
+/*
+ * Block until the scheduler hands the CPU to this thread.
+ */
+static void prvSuspendSelf( Thread_t *pxThread );
+
+/*
+ * Hand the CPU from one task thread to another.
+ */
+static void prvSwitchThread( Thread_t *pxThreadToResume, Thread_t *pxThreadToSuspend );
+
+/*
+ * Entry of every task thread.
+ */
+static void *prvThreadEntry( void *pvParameters );
+
+/*
+ * Common signal entry of every emulated interrupt line.
+ */
+static void prvInterruptEntry( int iSignal );
+
+/*
+ * The tick interrupt.
+ */
+static void prvTickHandler( void );
+
+/*
+ * Set up the interrupt signal set once.
+ */
+static void prvSetupSignals( void );
+
+/*-----------------------------------------------------------*/
+
+static void prvSetupSignals( void )
+{
+static BaseType_t xDone = pdFALSE;
+UBaseType_t uxLine;
+
+	if( xDone == pdFALSE )
+	{
+		sigemptyset( &xInterruptSignals );
+		for( uxLine = 0; uxLine < portMAX_INTERRUPTS; uxLine++ )
+		{
+			sigaddset( &xInterruptSignals, iPortInterruptSignal( uxLine ) );
+		}
+		xDone = pdTRUE;
+	}
+}
+/*-----------------------------------------------------------*/
+
+int iPortInterruptSignal( UBaseType_t uxLine )
+{
+	return SIGRTMIN + ( int ) uxLine;
+}
+/*-----------------------------------------------------------*/
+
+StackType_t *pxPortInitialiseStack( StackType_t *pxTopOfStack, TaskFunction_t pxCode, void *pvParameters )
+{
+Thread_t *pxThread;
+sigset_t xOldMask;
+
+	prvSetupSignals();
+
+	/* Carve the thread bookkeeping out of the top of the FreeRTOS stack; the
+	task itself runs on the stack of its POSIX thread. */
+	pxThread = ( Thread_t * ) ( ( ( portPOINTER_SIZE_TYPE ) pxTopOfStack - sizeof( Thread_t ) ) & ~( ( portPOINTER_SIZE_TYPE ) portBYTE_ALIGNMENT_MASK ) );
+	memset( pxThread, 0, sizeof( Thread_t ) );
+	pxThread->pxCode = pxCode;
+	pxThread->pvParameters = pvParameters;
+	pxThread->xDying = pdFALSE;
+	sem_init( &( pxThread->xWake ), 0, 0 );
+
+	/* The new thread inherits our signal mask, so create it with interrupts
+	masked and let it unblock them once it is first scheduled. */
+	pthread_sigmask( SIG_BLOCK, &xInterruptSignals, &xOldMask );
+	pthread_create( &( pxThread->xHandle ), NULL, prvThreadEntry, pxThread );
+	pthread_sigmask( SIG_SETMASK, &xOldMask, NULL );
+
+	return ( StackType_t * ) pxThread;
+}
+/*-----------------------------------------------------------*/
+
+static void *prvThreadEntry( void *pvParameters )
+{
+Thread_t *pxThread = ( Thread_t * ) pvParameters;
+
+	prvSuspendSelf( pxThread );
+
+	/* A task always starts outside of any critical section. */
+	uxCriticalNesting = 0;
+	vPortEnableInterrupts();
+	pxThread->pxCode( pxThread->pvParameters );
+
+	/* Tasks must not return; clean up as if it deleted itself. */
+	vTaskDelete( NULL );
+	return NULL;
+}
+/*-----------------------------------------------------------*/
+
+static void prvSuspendSelf( Thread_t *pxThread )
+{
+	while( sem_wait( &( pxThread->xWake ) ) != 0 )
+	{
+		/* Interrupted, retry. */
+	}
+
+	if( pxThread->xDying != pdFALSE )
+	{
+		pthread_exit( NULL );
+	}
+}
+/*-----------------------------------------------------------*/
+
+static void prvSwitchThread( Thread_t *pxThreadToResume, Thread_t *pxThreadToSuspend )
+{
+UBaseType_t uxSavedCriticalNesting;
+
+	if( pxThreadToResume != pxThreadToSuspend )
+	{
+		uxSavedCriticalNesting = uxCriticalNesting;
+		sem_post( &( pxThreadToResume->xWake ) );
+
+		if( pxThreadToSuspend->xDying != pdFALSE )
+		{
+			pthread_exit( NULL );
+		}
+
+		prvSuspendSelf( pxThreadToSuspend );
+		uxCriticalNesting = uxSavedCriticalNesting;
+	}
+}
+/*-----------------------------------------------------------*/
+
+BaseType_t xPortStartScheduler( void )
+{
+Thread_t *pxFirst;
+
+	prvSetupSignals();
+
+	/* The thread that started the scheduler never runs task code again. */
+	pthread_sigmask( SIG_BLOCK, &xInterruptSignals, NULL );
+	sem_init( &xSchedulerEnd, 0, 0 );
+
+	vPortInstallInterrupt( portTICK_INTERRUPT, prvTickHandler );
+	vPortSetupTimerInterrupt();
+
+	/* Start the first task. */
+	uxCriticalNesting = 0;
+	pxFirst = portTHREAD_OF( pxCurrentTCB );
+	sem_post( &( pxFirst->xWake ) );
+
+	while( sem_wait( &xSchedulerEnd ) != 0 )
+	{
+		/* Interrupted, retry. */
+	}
+
+	return 0;
+}
+/*-----------------------------------------------------------*/
+
+void vPortEndScheduler( void )
+{
+	vPortStopTimerInterrupt();
+	vPortDisableInterrupts();
+	sem_post( &xSchedulerEnd );
+
+	/* The calling task never resumes. */
+	prvSuspendSelf( portTHREAD_OF( pxCurrentTCB ) );
+}
+/*-----------------------------------------------------------*/
+
+void vPortYield( void )
+{
+Thread_t *pxThreadToSuspend;
+
+	vPortEnterCritical();
+	pxThreadToSuspend = portTHREAD_OF( pxCurrentTCB );
+	vTaskSwitchContext();
+	prvSwitchThread( portTHREAD_OF( pxCurrentTCB ), pxThreadToSuspend );
+	vPortExitCritical();
+}
+/*-----------------------------------------------------------*/
+
+void vPortYieldFromISR( void )
+{
+	xSwitchPending = pdTRUE;
+}
+/*-----------------------------------------------------------*/
+
+void vPortDisableInterrupts( void )
+{
+	pthread_sigmask( SIG_BLOCK, &xInterruptSignals, NULL );
+}
+/*-----------------------------------------------------------*/
+
+void vPortEnableInterrupts( void )
+{
+	pthread_sigmask( SIG_UNBLOCK, &xInterruptSignals, NULL );
+}
+/*-----------------------------------------------------------*/
+
+void vPortEnterCritical( void )
+{
+	vPortDisableInterrupts();
+	uxCriticalNesting++;
+}
+/*-----------------------------------------------------------*/
+
+void vPortExitCritical( void )
+{
+	uxCriticalNesting--;
+	if( uxCriticalNesting == 0 )
+	{
+		vPortEnableInterrupts();
+	}
+}
+/*-----------------------------------------------------------*/
+
+UBaseType_t uxPortSetInterruptMask( void )
+{
+sigset_t xOldMask;
+
+	pthread_sigmask( SIG_BLOCK, &xInterruptSignals, &xOldMask );
+
+	/* Report whether the lines were already masked, so nested use from
+	interrupts and from tasks both restore the right state. */
+	return ( UBaseType_t ) sigismember( &xOldMask, iPortInterruptSignal( portTICK_INTERRUPT ) );
+}
+/*-----------------------------------------------------------*/
+
+void vPortClearInterruptMask( UBaseType_t uxMask )
+{
+	if( uxMask == 0 )
+	{
+		vPortEnableInterrupts();
+	}
+}
+/*-----------------------------------------------------------*/
+
+static void prvInterruptEntry( int iSignal )
+{
+Thread_t *pxThreadToSuspend;
+int iSavedErrno;
+UBaseType_t uxLine;
+
+	iSavedErrno = errno;
+
+	/* All lines are masked while we are here. Count this as a critical
+	section so any kernel code called from the handler does not unmask. */
+	uxCriticalNesting++;
+
+	uxLine = ( UBaseType_t ) ( iSignal - SIGRTMIN );
+	if( ( uxLine < portMAX_INTERRUPTS ) && ( pxInterruptHandlers[ uxLine ] != NULL ) )
+	{
+		pxInterruptHandlers[ uxLine ]();
+	}
+
+	/* The PendSV equivalent: switch on the way out of the interrupt. */
+	if( xSwitchPending != pdFALSE )
+	{
+		xSwitchPending = pdFALSE;
+		pxThreadToSuspend = portTHREAD_OF( pxCurrentTCB );
+		vTaskSwitchContext();
+		prvSwitchThread( portTHREAD_OF( pxCurrentTCB ), pxThreadToSuspend );
+	}
+
+	uxCriticalNesting--;
+	errno = iSavedErrno;
+}
+/*-----------------------------------------------------------*/
+
+void vPortInstallInterrupt( UBaseType_t uxLine, void ( *pxHandler )( void ) )
+{
+struct sigaction xAction;
+
+	configASSERT( uxLine < portMAX_INTERRUPTS );
+	prvSetupSignals();
+
+	pxInterruptHandlers[ uxLine ] = pxHandler;
+
+	memset( &xAction, 0, sizeof( xAction ) );
+	xAction.sa_handler = prvInterruptEntry;
+	xAction.sa_mask = xInterruptSignals;
+	xAction.sa_flags = SA_RESTART;
+	sigaction( iPortInterruptSignal( uxLine ), &xAction, NULL );
+}
+/*-----------------------------------------------------------*/
+
+static void prvTickHandler( void )
+{
+	if( xTaskIncrementTick() != pdFALSE )
+	{
+		vPortYieldFromISR();
+	}
+}
+/*-----------------------------------------------------------*/
+
+void vPortSetupTimerInterrupt( void )
+{
+struct sigevent xEvent;
+struct itimerspec xPeriod;
+
+	if( xTickTimerCreated == pdFALSE )
+	{
+		memset( &xEvent, 0, sizeof( xEvent ) );
+		xEvent.sigev_notify = SIGEV_SIGNAL;
+		xEvent.sigev_signo = iPortInterruptSignal( portTICK_INTERRUPT );
+		timer_create( CLOCK_MONOTONIC, &xEvent, &xTickTimer );
+		xTickTimerCreated = pdTRUE;
+	}
+
+	xPeriod.it_interval.tv_sec = 0;
+	xPeriod.it_interval.tv_nsec = 1000000000L / configTICK_RATE_HZ;
+	xPeriod.it_value = xPeriod.it_interval;
+	timer_settime( xTickTimer, 0, &xPeriod, NULL );
+}
+/*-----------------------------------------------------------*/
+
+void vPortStopTimerInterrupt( void )
+{
+struct itimerspec xPeriod;
+
+	if( xTickTimerCreated != pdFALSE )
+	{
+		memset( &xPeriod, 0, sizeof( xPeriod ) );
+		timer_settime( xTickTimer, 0, &xPeriod, NULL );
+	}
+}
+/*-----------------------------------------------------------*/
+
+void vPortMarkTaskDying( void *pvTaskToDelete )
+{
+	portTHREAD_OF( pvTaskToDelete )->xDying = pdTRUE;
+}
+/*-----------------------------------------------------------*/
+
+void vPortCleanUpTask( void *pvTaskToDelete )
+{
+Thread_t *pxThread;
+
+	pxThread = portTHREAD_OF( pvTaskToDelete );
+
+	/* A task deleted by another task is still parked in prvSuspendSelf();
+	wake it so it can see the flag and exit. A task that deleted itself has
+	already exited or is about to. */
+	pxThread->xDying = pdTRUE;
+	sem_post( &( pxThread->xWake ) );
+	pthread_join( pxThread->xHandle, NULL );
+	sem_destroy( &( pxThread->xWake ) );
+}
+/*-----------------------------------------------------------*/
@@ -201,11 +201,9 @@ extern void xPortStartFirstTask( void );
 
 	#if( ( configMTIME_BASE_ADDRESS != 0 ) && ( configMTIMECMP_BASE_ADDRESS != 0 ) )
 	{
-		/* Enable mtime and external interrupts.  1<<7 for timer interrupt, 1<<11
-		for external interrupt.  _RB_ What happens here when mtime is not present as
-		with pulpino? */
-	    NVIC_EnableIRQ(SysTicK_IRQn);
-	    NVIC_EnableIRQ(Software_IRQn);
+		/* Enable mtime and software interrupts.  1<<7 for timer interrupt, 1<<3
+		for the software interrupt that portYIELD() raises through the CLINT. */
+		__asm volatile( "csrs mie, %0" :: "r"( 0x88 ) );
 	}
 	#else
 	{
@@ -231,6 +229,22 @@ void vPortEndScheduler( void )
 	for( ;; );
 }
 /*-----------------------------------------------------------*/
+#if( configMTIME_BASE_ADDRESS != 0 ) && ( configMTIMECMP_BASE_ADDRESS != 0 )
+
+/* The machine timer vector belongs to the board, which calls this from its
+handler just like the Cortex-M ports expose xPortSysTickHandler(). */
+void xPortSysTickHandler( void )
+{
+    *pullMachineTimerCompareRegister = ullNextTime;
+    ullNextTime += ( uint64_t ) uxTimerIncrementsForOneTick;
+    if( xTaskIncrementTick() != pdFALSE )
+    {
+        portYIELD();
+    }
+}
+
+#else
+
 void SysTick_Handler(void) __attribute__((interrupt("WCH-Interrupt-fast")));
 void SysTick_Handler( void )
 {
@@ -245,6 +259,8 @@ void SysTick_Handler( void )
     FREE_INT_SP();
 }
 
+#endif /* ( configMTIME_BASE_ADDRESS != 0 ) && ( configMTIMECMP_BASE_ADDRESS != 0 ) */
+
 /*-----------------------------------------------------------*/
 void vPortEnterCritical( void )
 {
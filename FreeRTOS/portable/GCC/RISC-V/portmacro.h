@@ -93,6 +93,17 @@ not need to be guarded with a critical section. */
 /* Scheduler utilities. */
 extern void vTaskSwitchContext( void );
 
+#ifdef configCLINT_MSIP_ADDRESS
+/* Standard CLINT: raise the machine software interrupt of this hart. Single
+hart only, the handler clears it again. */
+#define portYIELD() \
+do \
+{ \
+    *( ( volatile uint32_t * ) ( configCLINT_MSIP_ADDRESS ) ) = 1UL; \
+    __asm__ __volatile__("fence iorw,iorw":::"memory"); \
+} \
+while(0)
+#else
 #define portYIELD() \
 do \
 { \
@@ -100,6 +111,7 @@ do \
     __asm__ __volatile__("fence iorw,iorw":::"memory"); \
 } \
 while(0)
+#endif
 
 #define portEND_SWITCHING_ISR( xSwitchRequired ) do { if( xSwitchRequired ) portYIELD(); } while( 0 )
 #define portYIELD_FROM_ISR( x ) portEND_SWITCHING_ISR( x )
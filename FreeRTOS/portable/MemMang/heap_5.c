@@ -371,6 +371,31 @@ size_t xPortGetMinimumEverFreeHeapSize( void )
 }
 /*-----------------------------------------------------------*/
 
+size_t xPortGetLargestFreeBlockSize( void )
+{
+BlockLink_t *pxBlock;
+size_t xLargest = 0;
+
+	/* Walk the free list for the largest block, which over the free bytes
+	remaining tells how fragmented the heap is. */
+	vTaskSuspendAll();
+	{
+		pxBlock = xStart.pxNextFreeBlock;
+		while( ( pxBlock != NULL ) && ( pxBlock != pxEnd ) )
+		{
+			if( pxBlock->xBlockSize > xLargest )
+			{
+				xLargest = pxBlock->xBlockSize;
+			}
+			pxBlock = pxBlock->pxNextFreeBlock;
+		}
+	}
+	( void ) xTaskResumeAll();
+
+	return xLargest;
+}
+/*-----------------------------------------------------------*/
+
 static void prvInsertBlockIntoFreeList( BlockLink_t *pxBlockToInsert )
 {
 BlockLink_t *pxIterator;
@@ -0,0 +1,411 @@
+/******************************************************************************
+Filename    : test.h
+Author      : hrs
+Date        : 17/10/2026
+Licence     : The Unlicense; see LICENSE for details.
+Description : FreeRTOS init functions for the Linux host (POSIX port).
+******************************************************************************/
+
+/* Include *******************************************************************/
+#define _GNU_SOURCE
+#include <signal.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+#if defined(__x86_64__)||defined(__i386__)
+#include <x86intrin.h>
+#endif
+#include "FreeRTOSConfig.h"
+#include "FreeRTOS.h"
+#include "task.h"
+/* End Include ***************************************************************/
+
+/* Define ********************************************************************/
+/* Board name reported in the structured output */
+#define TEST_BOARD              "POSIX-HOST"
+/* Counter read wrapper - TSC cycles on x86, nanoseconds elsewhere */
+#define TEST_CNT_READ()         Counter_Read()
+/* The TSC does not run at configCPU_CLOCK_HZ, so its rate is measured */
+#define TEST_CNT_HZ             Counter_Hz
+/* How long the TSC is measured against the monotonic clock, in nanoseconds */
+#define COUNTER_CAL_NS          (100000000U)
+/* Exit when the tests are done instead of dumping counter overflows */
+#define TEST_EXIT
+/* Period of the emulated timer interrupt in nanoseconds */
+#define INT_PERIOD_NS           (100000U)
+/* Emulated interrupt line used for the periodic interrupt */
+#define INT_LINE                (1U)
+/* The interrupt storm sources, on their own lines. All lines are masked
+ * together, so the one meant to be above the kernel is not here */
+#define TEST_STORM
+#define STORM_RAW_LINE          (2U)
+#define STORM_API_LINE          (3U)
+
+#define Print_Int(INT)          Int_Print((int)(INT))
+#define Print_Str(STR)          Str_Print((const signed char*)(STR))
+
+/* write() is async-signal-safe, so printing from Int_Handler is fine */
+#define PUTCHAR(CHAR) \
+do \
+{ \
+    char Char=(char)(CHAR); \
+    if(write(STDOUT_FILENO,&Char,1)<0) \
+        break; \
+} \
+while(0)
+
+/* Console input for BENCH_CONSOLE - end of input reads as end of line */
+#define GETCHAR()               Char_Get()
+/* The host caches cannot be flushed, so cold runs read through a buffer
+ * larger than the L1 and L2 caches instead */
+#ifndef BENCH_EVICT_SIZE
+#define BENCH_EVICT_SIZE        (4U*1024U*1024U)
+#endif
+/* End Define ****************************************************************/
+
+/* Global ********************************************************************/
+void Int_Handler(void);
+void Storm_Raw_Handler(void);
+void Storm_Api_Handler(void);
+timer_t Int_Timer;
+/* The timer is created by the first test and only rearmed after that */
+int Int_Timer_Made=0;
+timer_t Storm_Timer[2];
+/* Rate of the counter in Hz, set by Timer_Init */
+uint32_t Counter_Hz=1000000000U;
+/* Lowest task priority the periodic interrupt has found the CPU at */
+UBaseType_t Int_Base_Prio=configMAX_PRIORITIES;
+/* End Global ****************************************************************/
+
+/* Function:Counter_Read ******************************************************
+Description : Read the free-running timestamp counter.
+Input       : None.
+Output      : None.
+Return      : uint32_t - The counter value.
+******************************************************************************/
+static inline uint32_t Counter_Read(void)
+{
+#if defined(__x86_64__)||defined(__i386__)
+    return (uint32_t)__rdtsc();
+#else
+    struct timespec Time;
+
+    clock_gettime(CLOCK_MONOTONIC,&Time);
+    return (uint32_t)(Time.tv_sec*1000000000ULL+Time.tv_nsec);
+#endif
+}
+/* End Function:Counter_Read *************************************************/
+
+/* Function:Char_Get *********************************************************
+Description : Read a character from the console.
+Input       : None.
+Output      : None.
+Return      : int - The character.
+******************************************************************************/
+int Char_Get(void)
+{
+    char Char;
+
+    if(read(STDIN_FILENO,&Char,1)!=1)
+        return '\n';
+    return Char;
+}
+/* End Function:Char_Get *****************************************************/
+
+/* Function:Low_Lvl_Init ******************************************************
+Description : Initialize underlying hardware.
+Input       : None.
+Output      : None.
+Return      : None.
+******************************************************************************/
+void Low_Lvl_Init(void)
+{
+    /* Nothing to do on the host - the console is stdout */
+}
+/* End Function:Low_Lvl_Init *************************************************/
+
+/* Function:Timer_Init ********************************************************
+Description : Initialize the timer for timing measurements. This function needs
+              to be adapted to your specific hardware.
+Input       : None.
+Output      : None.
+Return      : None.
+******************************************************************************/
+void Timer_Init(void)
+{
+#if defined(__x86_64__)||defined(__i386__)
+    struct timespec Begin;
+    struct timespec Now;
+    uint64_t Cycle;
+    uint64_t Time;
+
+    /* The TSC is always running, but its rate is not known */
+    clock_gettime(CLOCK_MONOTONIC,&Begin);
+    Cycle=__rdtsc();
+    do
+    {
+        clock_gettime(CLOCK_MONOTONIC,&Now);
+        Time=(uint64_t)(Now.tv_sec-Begin.tv_sec)*1000000000ULL+
+             (uint64_t)Now.tv_nsec-(uint64_t)Begin.tv_nsec;
+    }
+    while(Time<COUNTER_CAL_NS);
+    Cycle=__rdtsc()-Cycle;
+    Counter_Hz=(uint32_t)((Cycle*1000000000ULL)/Time);
+#else
+    /* The monotonic clock is always running, and counts nanoseconds */
+#endif
+}
+/* End Function:Timer_Init ***************************************************/
+
+/* Function:Tick_Disable ******************************************************
+Description : Disable the kernel tick source. This function needs to be adapted
+              to your specific hardware.
+Input       : None.
+Output      : None.
+Return      : None.
+******************************************************************************/
+void Tick_Disable(void)
+{
+    vPortStopTimerInterrupt();
+}
+/* End Function:Tick_Disable *************************************************/
+
+/* Function:Int_Timer_Handler *************************************************
+Description : The emulated timer interrupt. On the boards the period is long
+              enough that the task woken by one interrupt always blocks again
+              before the next one, so every edge finds the CPU back in the
+              background task. The host may deschedule us while the timer keeps
+              running, so an edge can arrive before that. Such an edge is
+              dropped, as it would otherwise overwrite the previous round.
+Input       : None.
+Output      : None.
+Return      : None.
+******************************************************************************/
+void Int_Timer_Handler(void)
+{
+    UBaseType_t Prio;
+
+    Prio=uxTaskPriorityGetFromISR(NULL);
+    if(Prio>Int_Base_Prio)
+        return;
+
+    Int_Base_Prio=Prio;
+    Int_Handler();
+}
+/* End Function:Int_Timer_Handler ********************************************/
+
+/* Function:Int_Init **********************************************************
+Description : Initialize an periodic interrupt source. This function needs
+              to be adapted to your specific hardware. Every timer counts
+              against RLIMIT_SIGPENDING, so one is made for all the tests.
+Input       : None.
+Output      : None.
+Return      : None.
+******************************************************************************/
+void Int_Init(void)
+{
+    struct sigevent Event;
+    struct itimerspec Period;
+
+    /* The first edge of every test finds out its background task again */
+    Int_Base_Prio=configMAX_PRIORITIES;
+    /* Attach the handler to an emulated interrupt line */
+    vPortInstallInterrupt(INT_LINE,Int_Timer_Handler);
+
+    if(Int_Timer_Made==0)
+    {
+        memset(&Event,0,sizeof(Event));
+        Event.sigev_notify=SIGEV_SIGNAL;
+        Event.sigev_signo=iPortInterruptSignal(INT_LINE);
+        timer_create(CLOCK_MONOTONIC,&Event,&Int_Timer);
+        Int_Timer_Made=1;
+    }
+
+    Period.it_interval.tv_sec=0;
+    Period.it_interval.tv_nsec=INT_PERIOD_NS;
+    Period.it_value=Period.it_interval;
+    timer_settime(Int_Timer,0,&Period,NULL);
+}
+/* End Function:Int_Init *****************************************************/
+
+/* Function:Int_Disable *******************************************************
+Description : Disable the periodic interrupt source. This function needs
+              to be adapted to your specific hardware.
+Input       : None.
+Output      : None.
+Return      : None.
+******************************************************************************/
+void Int_Disable(void)
+{
+    struct itimerspec Period;
+
+    /* Disarm the timer; timer_settime is async-signal-safe */
+    memset(&Period,0,sizeof(Period));
+    timer_settime(Int_Timer,0,&Period,NULL);
+}
+/* End Function:Int_Disable **************************************************/
+
+#ifdef BENCH_STORM
+/* Function:Storm_Init ********************************************************
+Description : Start the two interrupt storm sources. This function needs to
+              be adapted to your specific hardware.
+Input       : uint32_t Raw_Hz - The rate of the source above the kernel.
+              uint32_t Api_Hz - The rate of the source calling the kernel.
+Output      : None.
+Return      : None.
+******************************************************************************/
+void Storm_Timer_Start(timer_t* Timer, UBaseType_t Line, uint32_t Hz)
+{
+    struct sigevent Event;
+    struct itimerspec Period;
+
+    memset(&Event,0,sizeof(Event));
+    Event.sigev_notify=SIGEV_SIGNAL;
+    Event.sigev_signo=iPortInterruptSignal(Line);
+    timer_create(CLOCK_MONOTONIC,&Event,Timer);
+
+    Period.it_interval.tv_sec=0;
+    Period.it_interval.tv_nsec=1000000000U/Hz;
+    Period.it_value=Period.it_interval;
+    timer_settime(*Timer,0,&Period,NULL);
+}
+
+void Storm_Init(uint32_t Raw_Hz, uint32_t Api_Hz)
+{
+    vPortInstallInterrupt(STORM_RAW_LINE,Storm_Raw_Handler);
+    vPortInstallInterrupt(STORM_API_LINE,Storm_Api_Handler);
+    Storm_Timer_Start(&Storm_Timer[0],STORM_RAW_LINE,Raw_Hz);
+    Storm_Timer_Start(&Storm_Timer[1],STORM_API_LINE,Api_Hz);
+}
+/* End Function:Storm_Init ***************************************************/
+
+/* Function:Storm_Disable *****************************************************
+Description : Stop the two interrupt storm sources. This function needs to be
+              adapted to your specific hardware.
+Input       : None.
+Output      : None.
+Return      : None.
+******************************************************************************/
+void Storm_Disable(void)
+{
+    timer_delete(Storm_Timer[0]);
+    timer_delete(Storm_Timer[1]);
+}
+/* End Function:Storm_Disable ************************************************/
+#endif
+
+/* Function:Cache_Flush *******************************************************
+Description : Write back and invalidate all caches. This function needs to be
+              adapted to your specific hardware.
+Input       : None.
+Output      : None.
+Return      : None.
+******************************************************************************/
+void Cache_Flush(void)
+{
+    /* The host caches cannot be flushed from user space - the eviction
+     * buffer of the benchmark core stands in for this */
+}
+/* End Function:Cache_Flush **************************************************/
+
+/* Function:Test_Exit *********************************************************
+Description : Leave the benchmark once all tests are done.
+Input       : None.
+Output      : None.
+Return      : None.
+******************************************************************************/
+void Test_Exit(void)
+{
+    exit(0);
+}
+/* End Function:Test_Exit ****************************************************/
+
+/* Function:Int_Print *********************************************************
+Description : Print a signed integer on the debugging console. This integer is
+              printed as decimal with sign.
+Input       : int Int - The integer to print.
+Output      : None.
+Return      : int - The length of the string printed.
+******************************************************************************/
+int Int_Print(int Int)
+{
+    int Num;
+    int Abs;
+    int Iter;
+    int Count;
+    int Div;
+
+    /* Exit on zero */
+    if(Int==0)
+    {
+        PUTCHAR('0');
+        return 1;
+    }
+    /* Correct all negatives into positives */
+    if(Int<0)
+    {
+        PUTCHAR('-');
+        Abs=-Int;
+        Num=1;
+    }
+    else
+    {
+        Abs=Int;
+        Num=0;
+    }
+
+    /* How many digits are there? */
+    Count=0;
+    Div=1;
+    Iter=Abs;
+    while(1)
+    {
+        Iter/=10;
+        Count++;
+        if(Iter!=0)
+            Div*=10;
+        else
+            break;
+    }
+    Num+=Count;
+
+    /* Print the integer */
+    Iter=Abs;
+    while(Count>0)
+    {
+        Count--;
+        PUTCHAR((signed char)(Iter/Div)+'0');
+        Iter=Iter%Div;
+        Div/=10;
+    }
+
+    return Num;
+}
+/* End Function:Int_Print ****************************************************/
+
+/* Function:Str_Print *********************************************************
+Description : Print a string on the debugging console.
+Input       : const rmp_s8_t* String - The string to print.
+Output      : None.
+Return      : rmp_cnt_t - The length of the string printed, the '\0' is not included.
+******************************************************************************/
+int Str_Print(const signed char* String)
+{
+    uint32_t Count;
+
+    for(Count=0U;Count<255U;Count++)
+    {
+        if(String[Count]==(signed char)'\0')
+            break;
+
+        PUTCHAR(String[Count]);
+    }
+
+    return (uint32_t)Count;
+}
+/* End Function:Str_Print ****************************************************/
+
+/* End Of File ***************************************************************/
+
+/* Copyright (C) Evo-Devo Instrum. All rights reserved ***********************/
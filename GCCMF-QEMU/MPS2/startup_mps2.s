@@ -0,0 +1,146 @@
+/******************************************************************************
+Filename    : startup_mps2.s
+Author      : hrs
+Date        : 17/10/2026
+Licence     : The Unlicense; see LICENSE for details.
+Description : Startup code for the QEMU MPS2 AN385/AN386 machines. Only uses
+              ARMv6-M instructions so that the same file serves both the CM0
+              and the CM4F builds.
+******************************************************************************/
+
+/* Header ********************************************************************/
+    .syntax unified
+    .thumb
+
+    .global Reset_Handler
+    .global Default_Handler
+    .global Vector_Table
+/* End Header ****************************************************************/
+
+/* Vector Table **************************************************************/
+    .section .isr_vector,"a",%progbits
+    .type Vector_Table,%object
+Vector_Table:
+    .word _estack
+    .word Reset_Handler
+    .word NMI_Handler
+    .word HardFault_Handler
+    .word MemManage_Handler
+    .word BusFault_Handler
+    .word UsageFault_Handler
+    .word 0
+    .word 0
+    .word 0
+    .word 0
+    .word SVC_Handler
+    .word DebugMon_Handler
+    .word 0
+    .word PendSV_Handler
+    .word SysTick_Handler
+    /* IRQ 0-7: UART0-4 and GPIO, unused */
+    .rept 8
+    .word Default_Handler
+    .endr
+    /* IRQ 8: TIMER0 - free-running counter, interrupt not enabled */
+    .word Default_Handler
+    /* IRQ 9: TIMER1 - periodic interrupt source */
+    .word TIMER1_IRQHandler
+    /* IRQ 10: DUALTIMER - interrupt storm, both sources */
+    .word DUALTIMER_IRQHandler
+    /* IRQ 11-30: unused */
+    .rept 20
+    .word Default_Handler
+    .endr
+    /* IRQ 31: GPIO0 pin 7 - pended by software for the interrupt storm */
+    .word GPIO0_7_IRQHandler
+    .size Vector_Table,.-Vector_Table
+/* End Vector Table **********************************************************/
+
+/* Function:Reset_Handler *****************************************************
+Description : Copy the data section, clear the bss section, turn on the FPU when
+              there is one, and then jump to main.
+Input       : None.
+Output      : None.
+Return      : None.
+******************************************************************************/
+    .section .text.Reset_Handler,"ax",%progbits
+    .thumb_func
+    .type Reset_Handler,%function
+Reset_Handler:
+    /* Copy the data section initializers from flash */
+    LDR     R0,=_sdata
+    LDR     R1,=_edata
+    LDR     R2,=_sidata
+Data_Loop:
+    CMP     R0,R1
+    BCS     Data_Done
+    LDR     R3,[R2]
+    STR     R3,[R0]
+    ADDS    R0,R0,#4
+    ADDS    R2,R2,#4
+    B       Data_Loop
+Data_Done:
+    /* Zero the bss section */
+    LDR     R0,=_sbss
+    LDR     R1,=_ebss
+    MOVS    R3,#0
+Bss_Loop:
+    CMP     R0,R1
+    BCS     Bss_Done
+    STR     R3,[R0]
+    ADDS    R0,R0,#4
+    B       Bss_Loop
+Bss_Done:
+#ifdef __ARM_FP
+    /* Grant full access to CP10 and CP11 */
+    LDR     R0,=0xE000ED88
+    LDR     R1,[R0]
+    LDR     R2,=0x00F00000
+    ORRS    R1,R1,R2
+    STR     R1,[R0]
+    DSB
+    ISB
+#endif
+    BL      main
+Reset_Loop:
+    B       Reset_Loop
+    .size Reset_Handler,.-Reset_Handler
+/* End Function:Reset_Handler ************************************************/
+
+/* Function:Default_Handler ***************************************************
+Description : Catch-all for unexpected exceptions. Hang here so the debugger
+              shows where it happened.
+Input       : None.
+Output      : None.
+Return      : None.
+******************************************************************************/
+    .section .text.Default_Handler,"ax",%progbits
+    .thumb_func
+    .type Default_Handler,%function
+Default_Handler:
+    B       Default_Handler
+    .size Default_Handler,.-Default_Handler
+
+    .weak NMI_Handler
+    .thumb_set NMI_Handler,Default_Handler
+    .weak HardFault_Handler
+    .thumb_set HardFault_Handler,Default_Handler
+    .weak MemManage_Handler
+    .thumb_set MemManage_Handler,Default_Handler
+    .weak BusFault_Handler
+    .thumb_set BusFault_Handler,Default_Handler
+    .weak UsageFault_Handler
+    .thumb_set UsageFault_Handler,Default_Handler
+    .weak DebugMon_Handler
+    .thumb_set DebugMon_Handler,Default_Handler
+    .weak TIMER1_IRQHandler
+    .thumb_set TIMER1_IRQHandler,Default_Handler
+    .weak DUALTIMER_IRQHandler
+    .thumb_set DUALTIMER_IRQHandler,Default_Handler
+    .weak GPIO0_7_IRQHandler
+    .thumb_set GPIO0_7_IRQHandler,Default_Handler
+/* End Function:Default_Handler **********************************************/
+
+/* End Of File ***************************************************************/
+
+/* Copyright (C) Evo-Devo Instrum. All rights reserved ***********************/
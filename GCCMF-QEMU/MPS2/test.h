@@ -0,0 +1,432 @@
+/******************************************************************************
+Filename    : test.h
+Author      : hrs
+Date        : 17/10/2026
+Licence     : The Unlicense; see LICENSE for details.
+Description : FreeRTOS init functions for the QEMU MPS2 AN385/AN386 machines.
+******************************************************************************/
+
+/* Include *******************************************************************/
+#include "FreeRTOSConfig.h"
+#include "FreeRTOS.h"
+/* End Include ***************************************************************/
+
+/* Define ********************************************************************/
+/* Board name reported in the structured output */
+#ifdef __ARM_ARCH_6M__
+#define TEST_BOARD              "QEMU-MPS2-AN385"
+#else
+#define TEST_BOARD              "QEMU-MPS2-AN386"
+#endif
+/* CMSDK APB UART0 */
+#define UART0_DATA              *((volatile uint32_t*)(0x40004000U))
+#define UART0_STATE             *((volatile uint32_t*)(0x40004004U))
+#define UART0_CTRL              *((volatile uint32_t*)(0x40004008U))
+#define UART0_BAUDDIV           *((volatile uint32_t*)(0x40004010U))
+/* CMSDK APB TIMER0 - free-running timestamp counter */
+#define TIMER0_CTRL             *((volatile uint32_t*)(0x40000000U))
+#define TIMER0_VALUE            *((volatile uint32_t*)(0x40000004U))
+#define TIMER0_RELOAD           *((volatile uint32_t*)(0x40000008U))
+/* CMSDK APB TIMER1 - periodic interrupt source */
+#define TIMER1_CTRL             *((volatile uint32_t*)(0x40001000U))
+#define TIMER1_VALUE            *((volatile uint32_t*)(0x40001004U))
+#define TIMER1_RELOAD           *((volatile uint32_t*)(0x40001008U))
+#define TIMER1_INTCLEAR         *((volatile uint32_t*)(0x4000100CU))
+#define TIMER1_IRQ              (9U)
+/* CMSDK APB dual timer - interrupt storm sources, which share one line */
+#define DUALTIMER1_LOAD         *((volatile uint32_t*)(0x40002000U))
+#define DUALTIMER1_CTRL         *((volatile uint32_t*)(0x40002008U))
+#define DUALTIMER1_INTCLR       *((volatile uint32_t*)(0x4000200CU))
+#define DUALTIMER1_MIS          *((volatile uint32_t*)(0x40002014U))
+#define DUALTIMER2_LOAD         *((volatile uint32_t*)(0x40002020U))
+#define DUALTIMER2_CTRL         *((volatile uint32_t*)(0x40002028U))
+#define DUALTIMER2_INTCLR       *((volatile uint32_t*)(0x4000202CU))
+#define DUALTIMER2_MIS          *((volatile uint32_t*)(0x40002034U))
+#define DUALTIMER_IRQ           (10U)
+/* GPIO0 pin 7, left unused, so the dual timer pends it for the storm source
+ * that calls the kernel, which needs a priority of its own */
+#define STORM_API_IRQ           (31U)
+/* NVIC and SysTick, word access only so that ARMv6-M is happy as well */
+#define NVIC_ISER               *((volatile uint32_t*)(0xE000E100U))
+#define NVIC_ICER               *((volatile uint32_t*)(0xE000E180U))
+#define NVIC_ISPR               *((volatile uint32_t*)(0xE000E200U))
+#define NVIC_ICPR               *((volatile uint32_t*)(0xE000E280U))
+#define NVIC_IPR(X)             *((volatile uint32_t*)(0xE000E400U+((X)&~3U)))
+#define SYSTICK_CTRL            *((volatile uint32_t*)(0xE000E010U))
+#define SYSTICK_VAL             *((volatile uint32_t*)(0xE000E018U))
+
+/* All MPS2 APB peripherals run at 25MHz, that is 40ns per timer tick */
+#define TIMER_NS                (40U)
+/* Virtual nanoseconds per instruction is 2^ICOUNT_SHIFT when run with -icount */
+#ifndef ICOUNT_SHIFT
+#define ICOUNT_SHIFT            (6U)
+#endif
+/* Counter read wrapper - instructions when run with -icount */
+#define TEST_CNT_READ()         Counter_Read()
+/* Exit QEMU through semihosting when the tests are done */
+#define TEST_EXIT
+/* Period of the interrupt in timer ticks, about 10000 instructions */
+#define INT_PERIOD              ((10000U<<ICOUNT_SHIFT)/TIMER_NS)
+/* The interrupt storm sources - the raw one above the kernel, the other at
+ * the highest priority that may call it, both above the periodic interrupt.
+ * The rates are in virtual time, so by default they fire about every 2000
+ * and 8000 instructions rather than at the rates of a real clock */
+#define TEST_STORM
+#ifndef BENCH_STORM_HZ_RAW
+#define BENCH_STORM_HZ_RAW      (1000000000U/(2000U<<ICOUNT_SHIFT))
+#endif
+#ifndef BENCH_STORM_HZ_API
+#define BENCH_STORM_HZ_API      (1000000000U/(8000U<<ICOUNT_SHIFT))
+#endif
+#ifndef BENCH_STORM_PRIO_RAW
+#define BENCH_STORM_PRIO_RAW    (2U)
+#endif
+#ifndef BENCH_STORM_PRIO_API
+#define BENCH_STORM_PRIO_API    configLIBRARY_MAX_SYSCALL_INTERRUPT_PRIORITY
+#endif
+
+#define Print_Int(INT)          Int_Print((int)(INT))
+#define Print_Str(STR)          Str_Print((const signed char*)(STR))
+
+#define PUTCHAR(CHAR) \
+do \
+{ \
+    while((UART0_STATE&0x01U)!=0U); \
+    UART0_DATA=(uint32_t)(CHAR); \
+} \
+while(0)
+
+/* Console input for BENCH_CONSOLE */
+#define GETCHAR()               Char_Get()
+/* End Define ****************************************************************/
+
+/* Global ********************************************************************/
+void Int_Handler(void);
+void Storm_Raw_Handler(void);
+void Storm_Api_Handler(void);
+/* End Global ****************************************************************/
+
+/* Function:Counter_Read ******************************************************
+Description : Read the free-running timestamp counter. TIMER0 counts down, so
+              its value is inverted and then scaled from timer ticks to virtual
+              instructions.
+Input       : None.
+Output      : None.
+Return      : uint32_t - The counter value.
+******************************************************************************/
+static inline uint32_t Counter_Read(void)
+{
+    return (uint32_t)((((uint64_t)(~TIMER0_VALUE))*TIMER_NS)>>ICOUNT_SHIFT);
+}
+/* End Function:Counter_Read *************************************************/
+
+/* Function:Char_Get *********************************************************
+Description : Read a character from the console.
+Input       : None.
+Output      : None.
+Return      : int - The character.
+******************************************************************************/
+int Char_Get(void)
+{
+    while((UART0_STATE&0x02U)==0U);
+    return (int)(UART0_DATA&0xFFU);
+}
+/* End Function:Char_Get *****************************************************/
+
+/* Function:Low_Lvl_Init ******************************************************
+Description : Initialize underlying hardware.
+Input       : None.
+Output      : None.
+Return      : None.
+******************************************************************************/
+void Low_Lvl_Init(void)
+{
+    /* QEMU does not transmit unless the baud divider is at least 16 */
+    UART0_BAUDDIV=16U;
+    /* Enable transmitter and receiver */
+    UART0_CTRL=0x03U;
+}
+/* End Function:Low_Lvl_Init *************************************************/
+
+/* Function:Timer_Init ********************************************************
+Description : Initialize the timer for timing measurements. This function needs
+              to be adapted to your specific hardware.
+Input       : None.
+Output      : None.
+Return      : None.
+******************************************************************************/
+void Timer_Init(void)
+{
+    /* TIMER0 clock = 25MHz, full 32-bit range, no interrupt */
+    TIMER0_CTRL=0x00U;
+    TIMER0_RELOAD=0xFFFFFFFFU;
+    TIMER0_VALUE=0xFFFFFFFFU;
+    TIMER0_CTRL=0x01U;
+}
+/* End Function:Timer_Init ***************************************************/
+
+/* Function:Tick_Disable ******************************************************
+Description : Disable the kernel tick source. This function needs to be adapted
+              to your specific hardware.
+Input       : None.
+Output      : None.
+Return      : None.
+******************************************************************************/
+void Tick_Disable(void)
+{
+    SYSTICK_CTRL=0x00U;
+    SYSTICK_VAL=0x00U;
+}
+/* End Function:Tick_Disable *************************************************/
+
+/* Function:Int_Init **********************************************************
+Description : Initialize an periodic interrupt source. This function needs
+              to be adapted to your specific hardware.
+Input       : None.
+Output      : None.
+Return      : None.
+******************************************************************************/
+void Int_Init(void)
+{
+    uint32_t Shift;
+
+    /* TIMER1 clock = 25MHz */
+    TIMER1_CTRL=0x00U;
+    TIMER1_RELOAD=INT_PERIOD;
+    TIMER1_VALUE=INT_PERIOD;
+    TIMER1_INTCLEAR=0x01U;
+
+    /* Set the interrupt priority to the lowest, same as the kernel */
+    Shift=(TIMER1_IRQ&3U)*8U;
+    NVIC_IPR(TIMER1_IRQ)=(NVIC_IPR(TIMER1_IRQ)&~(0xFFU<<Shift))|
+                         (((uint32_t)configKERNEL_INTERRUPT_PRIORITY)<<Shift);
+    /* Enable timer 1 interrupt */
+    NVIC_ISER=1U<<TIMER1_IRQ;
+    /* Start the timer with interrupt enabled */
+    TIMER1_CTRL=0x09U;
+}
+
+/* The interrupt handler */
+void TIMER1_IRQHandler(void)
+{
+    TIMER1_INTCLEAR=0x01U;
+    Int_Handler();
+}
+/* End Function:Int_Init *****************************************************/
+
+/* Function:Int_Disable *******************************************************
+Description : Disable the periodic interrupt source. This function needs
+              to be adapted to your specific hardware.
+Input       : None.
+Output      : None.
+Return      : None.
+******************************************************************************/
+void Int_Disable(void)
+{
+    /* Disable timer 1 interrupt */
+    NVIC_ICER=1U<<TIMER1_IRQ;
+}
+/* End Function:Int_Disable **************************************************/
+
+#ifdef BENCH_STORM
+/* Function:Irq_Prio_Set ******************************************************
+Description : Set the priority of an interrupt, with word access only.
+Input       : uint32_t Irq - The interrupt number.
+              uint32_t Prio - The priority, in the configPRIO_BITS top bits.
+Output      : None.
+Return      : None.
+******************************************************************************/
+static inline void Irq_Prio_Set(uint32_t Irq, uint32_t Prio)
+{
+    uint32_t Shift;
+
+    Shift=(Irq&3U)*8U;
+    NVIC_IPR(Irq)=(NVIC_IPR(Irq)&~(0xFFU<<Shift))|
+                  (((Prio<<(8U-configPRIO_BITS))&0xFFU)<<Shift);
+}
+/* End Function:Irq_Prio_Set *************************************************/
+
+/* Function:Storm_Init ********************************************************
+Description : Start the two interrupt storm sources. This function needs to
+              be adapted to your specific hardware. Both halves of the dual
+              timer raise the same line, so that line is at the priority of
+              the raw source, and the other source is passed on to a line of
+              its own at the priority that may call the kernel.
+Input       : uint32_t Raw_Hz - The rate of the source above the kernel.
+              uint32_t Api_Hz - The rate of the source calling the kernel.
+Output      : None.
+Return      : None.
+******************************************************************************/
+void Storm_Init(uint32_t Raw_Hz, uint32_t Api_Hz)
+{
+    /* Dual timer clock = 25MHz; periodic, 32-bit, interrupt enabled */
+    DUALTIMER1_CTRL=0x00U;
+    DUALTIMER2_CTRL=0x00U;
+    DUALTIMER1_LOAD=(1000000000U/TIMER_NS)/Raw_Hz-1U;
+    DUALTIMER2_LOAD=(1000000000U/TIMER_NS)/Api_Hz-1U;
+    DUALTIMER1_INTCLR=0x01U;
+    DUALTIMER2_INTCLR=0x01U;
+
+    Irq_Prio_Set(DUALTIMER_IRQ,BENCH_STORM_PRIO_RAW);
+    Irq_Prio_Set(STORM_API_IRQ,BENCH_STORM_PRIO_API);
+    NVIC_ICPR=1U<<STORM_API_IRQ;
+    NVIC_ISER=(1U<<DUALTIMER_IRQ)|(1U<<STORM_API_IRQ);
+    DUALTIMER1_CTRL=0xE2U;
+    DUALTIMER2_CTRL=0xE2U;
+}
+
+/* The interrupt handlers */
+void DUALTIMER_IRQHandler(void)
+{
+    if(DUALTIMER1_MIS!=0U)
+    {
+        DUALTIMER1_INTCLR=0x01U;
+        Storm_Raw_Handler();
+    }
+    if(DUALTIMER2_MIS!=0U)
+    {
+        DUALTIMER2_INTCLR=0x01U;
+        NVIC_ISPR=1U<<STORM_API_IRQ;
+    }
+}
+
+void GPIO0_7_IRQHandler(void)
+{
+    Storm_Api_Handler();
+}
+/* End Function:Storm_Init ***************************************************/
+
+/* Function:Storm_Disable *****************************************************
+Description : Stop the two interrupt storm sources. This function needs to be
+              adapted to your specific hardware.
+Input       : None.
+Output      : None.
+Return      : None.
+******************************************************************************/
+void Storm_Disable(void)
+{
+    NVIC_ICER=(1U<<DUALTIMER_IRQ)|(1U<<STORM_API_IRQ);
+    DUALTIMER1_CTRL=0x00U;
+    DUALTIMER2_CTRL=0x00U;
+}
+/* End Function:Storm_Disable ************************************************/
+#endif
+
+/* Function:Cache_Flush *******************************************************
+Description : Write back and invalidate all caches. This function needs to be
+              adapted to your specific hardware.
+Input       : None.
+Output      : None.
+Return      : None.
+******************************************************************************/
+void Cache_Flush(void)
+{
+    /* QEMU does not model caches */
+}
+/* End Function:Cache_Flush **************************************************/
+
+/* Function:Test_Exit *********************************************************
+Description : Leave the benchmark once all tests are done. This uses the ARM
+              semihosting SYS_EXIT call with ADP_Stopped_ApplicationExit.
+Input       : None.
+Output      : None.
+Return      : None.
+******************************************************************************/
+void Test_Exit(void)
+{
+    __asm volatile("movs r0, #0x18 \n"
+                   "ldr r1, =0x20026 \n"
+                   "bkpt 0xAB \n"
+                   :::"r0","r1","memory");
+    while(1);
+}
+/* End Function:Test_Exit ****************************************************/
+
+/* Function:Int_Print *********************************************************
+Description : Print a signed integer on the debugging console. This integer is
+              printed as decimal with sign.
+Input       : int Int - The integer to print.
+Output      : None.
+Return      : int - The length of the string printed.
+******************************************************************************/
+int Int_Print(int Int)
+{
+    int Num;
+    int Abs;
+    int Iter;
+    int Count;
+    int Div;
+
+    /* Exit on zero */
+    if(Int==0)
+    {
+        PUTCHAR('0');
+        return 1;
+    }
+    /* Correct all negatives into positives */
+    if(Int<0)
+    {
+        PUTCHAR('-');
+        Abs=-Int;
+        Num=1;
+    }
+    else
+    {
+        Abs=Int;
+        Num=0;
+    }
+
+    /* How many digits are there? */
+    Count=0;
+    Div=1;
+    Iter=Abs;
+    while(1)
+    {
+        Iter/=10;
+        Count++;
+        if(Iter!=0)
+            Div*=10;
+        else
+            break;
+    }
+    Num+=Count;
+
+    /* Print the integer */
+    Iter=Abs;
+    while(Count>0)
+    {
+        Count--;
+        PUTCHAR((signed char)(Iter/Div)+'0');
+        Iter=Iter%Div;
+        Div/=10;
+    }
+
+    return Num;
+}
+/* End Function:Int_Print ****************************************************/
+
+/* Function:Str_Print *********************************************************
+Description : Print a string on the debugging console.
+Input       : const rmp_s8_t* String - The string to print.
+Output      : None.
+Return      : rmp_cnt_t - The length of the string printed, the '\0' is not included.
+******************************************************************************/
+int Str_Print(const signed char* String)
+{
+    uint32_t Count;
+
+    for(Count=0U;Count<255U;Count++)
+    {
+        if(String[Count]==(signed char)'\0')
+            break;
+
+        PUTCHAR(String[Count]);
+    }
+
+    return (uint32_t)Count;
+}
+/* End Function:Str_Print ****************************************************/
+
+/* End Of File ***************************************************************/
+
+/* Copyright (C) Evo-Devo Instrum. All rights reserved ***********************/
@@ -0,0 +1,91 @@
+/******************************************************************************
+Filename    : startup_virt.s
+Author      : hrs
+Date        : 17/10/2026
+Licence     : The Unlicense; see LICENSE for details.
+Description : Startup code for the QEMU RISC-V virt machine, single hart in
+              machine mode. The trap vector runs in vectored mode so that the
+              machine software interrupt lands straight in the port's
+              SW_Handler, just like the PFIC does on the CH32V307.
+******************************************************************************/
+
+/* Header ********************************************************************/
+    .global Reset_Handler
+    .global Vector_Table
+/* End Header ****************************************************************/
+
+/* Function:Reset_Handler *****************************************************
+Description : Set up gp and sp, clear the bss section, install the vector table
+              and then jump to main. QEMU loads the image to its link address,
+              so there is no data section to copy.
+Input       : None.
+Output      : None.
+Return      : None.
+******************************************************************************/
+    .section .init,"ax",@progbits
+    .type Reset_Handler,@function
+Reset_Handler:
+    .option push
+    .option norelax
+    la      gp,__global_pointer$
+    .option pop
+    la      sp,__freertos_irq_stack_top
+    /* All interrupts off until the scheduler starts */
+    csrw    mie,zero
+    csrci   mstatus,0x08
+    /* Zero the bss section */
+    la      t0,_sbss
+    la      t1,_ebss
+Bss_Loop:
+    bgeu    t0,t1,Bss_Done
+    sw      zero,0(t0)
+    addi    t0,t0,4
+    j       Bss_Loop
+Bss_Done:
+    /* Vectored mode */
+    la      t0,Vector_Table
+    ori     t0,t0,1
+    csrw    mtvec,t0
+    call    main
+Reset_Loop:
+    j       Reset_Loop
+    .size Reset_Handler,.-Reset_Handler
+/* End Function:Reset_Handler ************************************************/
+
+/* Vector Table **************************************************************/
+    .section .text.Vector_Table,"ax",@progbits
+    .balign 64
+Vector_Table:
+    /* 0: exceptions */
+    j       Default_Handler
+    j       Default_Handler
+    j       Default_Handler
+    /* 3: machine software interrupt - context switch */
+    j       SW_Handler
+    j       Default_Handler
+    j       Default_Handler
+    j       Default_Handler
+    /* 7: machine timer interrupt - tick or periodic interrupt source */
+    j       MTIMER_Handler
+    j       Default_Handler
+    j       Default_Handler
+    j       Default_Handler
+    j       Default_Handler
+/* End Vector Table **********************************************************/
+
+/* Function:Default_Handler ***************************************************
+Description : Catch-all for unexpected traps. Hang here so the debugger shows
+              mcause and mepc.
+Input       : None.
+Output      : None.
+Return      : None.
+******************************************************************************/
+    .type Default_Handler,@function
+Default_Handler:
+    j       Default_Handler
+    .size Default_Handler,.-Default_Handler
+/* End Function:Default_Handler **********************************************/
+
+/* End Of File ***************************************************************/
+
+/* Copyright (C) Evo-Devo Instrum. All rights reserved ***********************/
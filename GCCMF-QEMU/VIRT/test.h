@@ -0,0 +1,327 @@
+/******************************************************************************
+Filename    : test.h
+Author      : hrs
+Date        : 17/10/2026
+Licence     : The Unlicense; see LICENSE for details.
+Description : FreeRTOS init functions for the QEMU RISC-V virt machine.
+******************************************************************************/
+
+/* Include *******************************************************************/
+#include "FreeRTOSConfig.h"
+#include "FreeRTOS.h"
+#include "task.h"
+/* End Include ***************************************************************/
+
+/* Define ********************************************************************/
+/* Board name reported in the structured output */
+#define TEST_BOARD              "QEMU-VIRT-RV32"
+/* NS16550 UART0 */
+#define UART0_THR               *((volatile uint8_t*)(0x10000000U))
+#define UART0_RBR               *((volatile uint8_t*)(0x10000000U))
+#define UART0_LSR               *((volatile uint8_t*)(0x10000005U))
+/* CLINT machine timer of hart 0 */
+#define CLINT_MTIME_LO          *((volatile uint32_t*)(configMTIME_BASE_ADDRESS))
+#define CLINT_MTIME_HI          *((volatile uint32_t*)(configMTIME_BASE_ADDRESS+4U))
+#define CLINT_MTIMECMP_LO       *((volatile uint32_t*)(configMTIMECMP_BASE_ADDRESS))
+#define CLINT_MTIMECMP_HI       *((volatile uint32_t*)(configMTIMECMP_BASE_ADDRESS+4U))
+/* SiFive test device, used to power off */
+#define TEST_FINISHER           *((volatile uint32_t*)(0x00100000U))
+
+/* mtime runs at 10MHz, that is 100ns per tick */
+#define MTIME_NS                (100U)
+/* Virtual nanoseconds per instruction is 2^ICOUNT_SHIFT when run with -icount */
+#ifndef ICOUNT_SHIFT
+#define ICOUNT_SHIFT            (6U)
+#endif
+/* Counter read wrapper - retired instructions, exact when run with -icount */
+#define TEST_CNT_READ()         Counter_Read()
+/* Power off QEMU when the tests are done */
+#define TEST_EXIT
+/* Period of the interrupt in mtime ticks, about 10000 instructions */
+#define INT_PERIOD              ((10000U<<ICOUNT_SHIFT)/MTIME_NS)
+
+#define Print_Int(INT)          Int_Print((int)(INT))
+#define Print_Str(STR)          Str_Print((const signed char*)(STR))
+
+#define PUTCHAR(CHAR) \
+do \
+{ \
+    while((UART0_LSR&0x20U)==0U); \
+    UART0_THR=(uint8_t)(CHAR); \
+} \
+while(0)
+
+/* Console input for BENCH_CONSOLE */
+#define GETCHAR()               Char_Get()
+/* End Define ****************************************************************/
+
+/* Global ********************************************************************/
+void Int_Handler(void);
+void xPortSysTickHandler(void);
+/* Whether the machine timer now drives the periodic interrupt, not the tick */
+volatile uint32_t Int_Active=0U;
+uint64_t Int_Next=0U;
+/* End Global ****************************************************************/
+
+/* Function:Counter_Read ******************************************************
+Description : Read the free-running timestamp counter.
+Input       : None.
+Output      : None.
+Return      : uint32_t - The counter value.
+******************************************************************************/
+static inline uint32_t Counter_Read(void)
+{
+    uint32_t Count;
+
+    __asm volatile("csrr %0, minstret":"=r"(Count));
+    return Count;
+}
+/* End Function:Counter_Read *************************************************/
+
+/* Function:Mtimecmp_Set ******************************************************
+Description : Program the machine timer compare register without raising a
+              spurious interrupt halfway through the 64-bit write.
+Input       : uint64_t Time - The new compare value.
+Output      : None.
+Return      : None.
+******************************************************************************/
+static inline void Mtimecmp_Set(uint64_t Time)
+{
+    CLINT_MTIMECMP_HI=0xFFFFFFFFU;
+    CLINT_MTIMECMP_LO=(uint32_t)Time;
+    CLINT_MTIMECMP_HI=(uint32_t)(Time>>32);
+}
+/* End Function:Mtimecmp_Set *************************************************/
+
+/* Function:Char_Get *********************************************************
+Description : Read a character from the console.
+Input       : None.
+Output      : None.
+Return      : int - The character.
+******************************************************************************/
+int Char_Get(void)
+{
+    while((UART0_LSR&0x01U)==0U);
+    return (int)UART0_RBR;
+}
+/* End Function:Char_Get *****************************************************/
+
+/* Function:Low_Lvl_Init ******************************************************
+Description : Initialize underlying hardware.
+Input       : None.
+Output      : None.
+Return      : None.
+******************************************************************************/
+void Low_Lvl_Init(void)
+{
+    /* The QEMU UART needs no setup */
+}
+/* End Function:Low_Lvl_Init *************************************************/
+
+/* Function:Timer_Init ********************************************************
+Description : Initialize the timer for timing measurements. This function needs
+              to be adapted to your specific hardware.
+Input       : None.
+Output      : None.
+Return      : None.
+******************************************************************************/
+void Timer_Init(void)
+{
+    /* minstret is always counting */
+}
+/* End Function:Timer_Init ***************************************************/
+
+/* Function:Tick_Disable ******************************************************
+Description : Disable the kernel tick source. This function needs to be adapted
+              to your specific hardware.
+Input       : None.
+Output      : None.
+Return      : None.
+******************************************************************************/
+void Tick_Disable(void)
+{
+    __asm volatile("csrc mie, %0"::"r"(0x80U));
+    Mtimecmp_Set((uint64_t)-1);
+}
+/* End Function:Tick_Disable *************************************************/
+
+/* Function:Int_Init **********************************************************
+Description : Initialize an periodic interrupt source. This function needs
+              to be adapted to your specific hardware. There is only the one
+              machine timer, so it is taken over from the tick, which the
+              tests have already disabled.
+Input       : None.
+Output      : None.
+Return      : None.
+******************************************************************************/
+void Int_Init(void)
+{
+    uint32_t High;
+    uint32_t Low;
+
+    do
+    {
+        High=CLINT_MTIME_HI;
+        Low=CLINT_MTIME_LO;
+    }
+    while(High!=CLINT_MTIME_HI);
+
+    Int_Active=1U;
+    Int_Next=((((uint64_t)High)<<32)|Low)+INT_PERIOD;
+    Mtimecmp_Set(Int_Next);
+    __asm volatile("csrs mie, %0"::"r"(0x80U));
+}
+
+void Int_Timer_Handler(void) __attribute__((noinline));
+void Int_Timer_Handler(void)
+{
+    if(Int_Active!=0U)
+    {
+        Int_Next+=INT_PERIOD;
+        Mtimecmp_Set(Int_Next);
+        Int_Handler();
+    }
+    else
+        xPortSysTickHandler();
+}
+
+/* The interrupt handler, shared by the tick and the periodic interrupt. Only a
+   call is made on the interrupt stack, as in the port's own SysTick_Handler. */
+void MTIMER_Handler(void) __attribute__((interrupt("machine")));
+void MTIMER_Handler(void)
+{
+    GET_INT_SP();
+    Int_Timer_Handler();
+    FREE_INT_SP();
+}
+/* End Function:Int_Init *****************************************************/
+
+/* Function:Int_Disable *******************************************************
+Description : Disable the periodic interrupt source. This function needs
+              to be adapted to your specific hardware.
+Input       : None.
+Output      : None.
+Return      : None.
+******************************************************************************/
+void Int_Disable(void)
+{
+    /* Disable the machine timer interrupt */
+    __asm volatile("csrc mie, %0"::"r"(0x80U));
+}
+/* End Function:Int_Disable **************************************************/
+
+/* Function:Cache_Flush *******************************************************
+Description : Write back and invalidate all caches. This function needs to be
+              adapted to your specific hardware.
+Input       : None.
+Output      : None.
+Return      : None.
+******************************************************************************/
+void Cache_Flush(void)
+{
+    /* QEMU does not model caches */
+}
+/* End Function:Cache_Flush **************************************************/
+
+/* Function:Test_Exit *********************************************************
+Description : Leave the benchmark once all tests are done.
+Input       : None.
+Output      : None.
+Return      : None.
+******************************************************************************/
+void Test_Exit(void)
+{
+    /* FINISHER_PASS */
+    TEST_FINISHER=0x5555U;
+    while(1);
+}
+/* End Function:Test_Exit ****************************************************/
+
+/* Function:Int_Print *********************************************************
+Description : Print a signed integer on the debugging console. This integer is
+              printed as decimal with sign.
+Input       : int Int - The integer to print.
+Output      : None.
+Return      : int - The length of the string printed.
+******************************************************************************/
+int Int_Print(int Int)
+{
+    int Num;
+    int Abs;
+    int Iter;
+    int Count;
+    int Div;
+
+    /* Exit on zero */
+    if(Int==0)
+    {
+        PUTCHAR('0');
+        return 1;
+    }
+    /* Correct all negatives into positives */
+    if(Int<0)
+    {
+        PUTCHAR('-');
+        Abs=-Int;
+        Num=1;
+    }
+    else
+    {
+        Abs=Int;
+        Num=0;
+    }
+
+    /* How many digits are there? */
+    Count=0;
+    Div=1;
+    Iter=Abs;
+    while(1)
+    {
+        Iter/=10;
+        Count++;
+        if(Iter!=0)
+            Div*=10;
+        else
+            break;
+    }
+    Num+=Count;
+
+    /* Print the integer */
+    Iter=Abs;
+    while(Count>0)
+    {
+        Count--;
+        PUTCHAR((signed char)(Iter/Div)+'0');
+        Iter=Iter%Div;
+        Div/=10;
+    }
+
+    return Num;
+}
+/* End Function:Int_Print ****************************************************/
+
+/* Function:Str_Print *********************************************************
+Description : Print a string on the debugging console.
+Input       : const rmp_s8_t* String - The string to print.
+Output      : None.
+Return      : rmp_cnt_t - The length of the string printed, the '\0' is not included.
+******************************************************************************/
+int Str_Print(const signed char* String)
+{
+    uint32_t Count;
+
+    for(Count=0U;Count<255U;Count++)
+    {
+        if(String[Count]==(signed char)'\0')
+            break;
+
+        PUTCHAR(String[Count]);
+    }
+
+    return (uint32_t)Count;
+}
+/* End Function:Str_Print ****************************************************/
+
+/* End Of File ***************************************************************/
+
+/* Copyright (C) Evo-Devo Instrum. All rights reserved ***********************/
@@ -14,18 +14,60 @@ Description : FreeRTOS init functions.
 /* End Include ***************************************************************/
 
 /* Define ********************************************************************/
+/* Board name reported in the structured output */
+#define TEST_BOARD              "CH32V307VC"
 #define Print_Int(INT)          Int_Print((int)(INT))
 #define Print_Str(STR)          Str_Print((const signed char*)(STR))
 
 #define PUTCHAR(CHAR)           putchar(CHAR)
+
+/* Counter read wrapper - low word of the mcycle cycle counter */
+#define TEST_CNT_READ()         Counter_Read()
+/* Cycles since the periodic interrupt was raised - TIM4 counts down from ATRLR
+ * at the CPU clock */
+#define TEST_INT_LATENCY()      (TIM4->ATRLR-TIM4->CNT)
+/* The minimal stack is 1kB here, so fewer helper tasks fit the heap */
+#define BENCH_HELPER_NUM        (15U)
+/* The interrupt storm sources - preemption priorities of TIM2 and TIM3, both
+ * above the periodic interrupt; critical sections clear MIE, so the first is
+ * not above the kernel */
+#define TEST_STORM
+#ifndef BENCH_STORM_PRIO_RAW
+#define BENCH_STORM_PRIO_RAW    (0U)
+#endif
+#ifndef BENCH_STORM_PRIO_API
+#define BENCH_STORM_PRIO_API    (1U)
+#endif
+/* Preemption priority of the periodic interrupt, below the storm sources */
+#define INT_PRIO                (2U)
 /* End Define ****************************************************************/
 
 /* Global ********************************************************************/
 void Int_Handler(void);
+void Storm_Raw_Handler(void);
+void Storm_Api_Handler(void);
 TIM_TimeBaseInitTypeDef TIM4_Handle={0};
+TIM_TimeBaseInitTypeDef TIM2_Handle={0};
+TIM_TimeBaseInitTypeDef TIM3_Handle={0};
 NVIC_InitTypeDef NVIC_InitStruture={0};
 /* End Global ****************************************************************/
 
+/* Function:Counter_Read ******************************************************
+Description : Read the free-running timestamp counter. 32-bit deltas only need
+              the low word, so mcycleh is left alone.
+Input       : None.
+Output      : None.
+Return      : uint32_t - The counter value.
+******************************************************************************/
+static inline uint32_t Counter_Read(void)
+{
+    uint32_t Cycle;
+    
+    __asm volatile("csrr %0, mcycle":"=r"(Cycle));
+    return Cycle;
+}
+/* End Function:Counter_Read *************************************************/
+
 /* Function:Low_Lvl_Init ******************************************************
 Description : Initialize underlying hardware.
 Input       : None.
@@ -49,14 +91,25 @@ Return      : None.
 ******************************************************************************/
 void Timer_Init(void)
 {
-    /* TIM1 clock = CPU clock */
-    RCC_APB2PeriphClockCmd(RCC_APB2Periph_TIM1, ENABLE);
-    TIM_CounterModeConfig(TIM1, TIM_CounterMode_Up);
-    TIM_InternalClockConfig(TIM1);
-    TIM_Cmd(TIM1, ENABLE);
+    /* mcycle clock = CPU clock, and it runs from reset */
 }
 /* End Function:Timer_Init ***************************************************/
 
+/* Function:Tick_Disable ******************************************************
+Description : Disable the kernel tick source. This function needs to be adapted
+              to your specific hardware.
+Input       : None.
+Output      : None.
+Return      : None.
+******************************************************************************/
+void Tick_Disable(void)
+{
+    SysTick->CNT=0x00U;
+    SysTick->CMP=0x00U;
+    SysTick->CTLR=0x00U;
+}
+/* End Function:Tick_Disable *************************************************/
+
 /* Function:Int_Init **********************************************************
 Description : Initialize an periodic interrupt source. This function needs
               to be adapted to your specific hardware.
@@ -77,7 +130,7 @@ void Int_Init(void)
     TIM_ClearITPendingBit(TIM4, TIM_IT_Update);
 
     NVIC_InitStruture.NVIC_IRQChannel = TIM4_IRQn;
-    NVIC_InitStruture.NVIC_IRQChannelPreemptionPriority = 0;
+    NVIC_InitStruture.NVIC_IRQChannelPreemptionPriority = INT_PRIO;
     NVIC_InitStruture.NVIC_IRQChannelSubPriority = 0;
     NVIC_InitStruture.NVIC_IRQChannelCmd = ENABLE;
     NVIC_Init(&NVIC_InitStruture);
@@ -107,6 +160,95 @@ void Int_Disable(void)
 }
 /* End Function:Int_Disable **************************************************/
 
+#ifdef BENCH_STORM
+/* Function:Storm_Init ********************************************************
+Description : Start the two interrupt storm sources. This function needs to
+              be adapted to your specific hardware.
+Input       : uint32_t Raw_Hz - The rate of the source above the kernel.
+              uint32_t Api_Hz - The rate of the source calling the kernel.
+Output      : None.
+Return      : None.
+******************************************************************************/
+void Storm_Init(uint32_t Raw_Hz, uint32_t Api_Hz)
+{
+    /* TIM2 and TIM3 clock = CPU clock; both are only 16-bit,
+     * so no slower than 2.2kHz */
+    RCC_APB1PeriphClockCmd(RCC_APB1Periph_TIM2|RCC_APB1Periph_TIM3, ENABLE);
+    TIM2_Handle.TIM_Prescaler = 0;
+    TIM2_Handle.TIM_CounterMode = TIM_CounterMode_Down;
+    TIM2_Handle.TIM_Period = SystemCoreClock/Raw_Hz-1U;
+    TIM2_Handle.TIM_ClockDivision = TIM_CKD_DIV1;
+    TIM2_Handle.TIM_RepetitionCounter = 0;
+    TIM_TimeBaseInit(TIM2,&TIM2_Handle);
+    TIM_ClearITPendingBit(TIM2, TIM_IT_Update);
+    TIM3_Handle.TIM_Prescaler = 0;
+    TIM3_Handle.TIM_CounterMode = TIM_CounterMode_Down;
+    TIM3_Handle.TIM_Period = SystemCoreClock/Api_Hz-1U;
+    TIM3_Handle.TIM_ClockDivision = TIM_CKD_DIV1;
+    TIM3_Handle.TIM_RepetitionCounter = 0;
+    TIM_TimeBaseInit(TIM3,&TIM3_Handle);
+    TIM_ClearITPendingBit(TIM3, TIM_IT_Update);
+
+    NVIC_InitStruture.NVIC_IRQChannel = TIM2_IRQn;
+    NVIC_InitStruture.NVIC_IRQChannelPreemptionPriority = BENCH_STORM_PRIO_RAW;
+    NVIC_InitStruture.NVIC_IRQChannelSubPriority = 0;
+    NVIC_InitStruture.NVIC_IRQChannelCmd = ENABLE;
+    NVIC_Init(&NVIC_InitStruture);
+    NVIC_InitStruture.NVIC_IRQChannel = TIM3_IRQn;
+    NVIC_InitStruture.NVIC_IRQChannelPreemptionPriority = BENCH_STORM_PRIO_API;
+    NVIC_Init(&NVIC_InitStruture);
+    TIM_ITConfig(TIM2, TIM_IT_Update, ENABLE);
+    TIM_ITConfig(TIM3, TIM_IT_Update, ENABLE);
+    TIM_Cmd(TIM2, ENABLE);
+    TIM_Cmd(TIM3, ENABLE);
+}
+
+/* The interrupt handlers */
+void TIM2_IRQHandler(void) __attribute__((interrupt("WCH-Interrupt-fast")));
+void TIM2_IRQHandler(void)
+{
+    TIM_ClearITPendingBit(TIM2, TIM_IT_Update);
+    Storm_Raw_Handler();
+}
+
+void TIM3_IRQHandler(void) __attribute__((interrupt("WCH-Interrupt-fast")));
+void TIM3_IRQHandler(void)
+{
+    TIM_ClearITPendingBit(TIM3, TIM_IT_Update);
+    Storm_Api_Handler();
+}
+/* End Function:Storm_Init ***************************************************/
+
+/* Function:Storm_Disable *****************************************************
+Description : Stop the two interrupt storm sources. This function needs to be
+              adapted to your specific hardware.
+Input       : None.
+Output      : None.
+Return      : None.
+******************************************************************************/
+void Storm_Disable(void)
+{
+    NVIC_DisableIRQ(TIM2_IRQn);
+    NVIC_DisableIRQ(TIM3_IRQn);
+    TIM_Cmd(TIM2, DISABLE);
+    TIM_Cmd(TIM3, DISABLE);
+}
+/* End Function:Storm_Disable ************************************************/
+#endif
+
+/* Function:Cache_Flush *******************************************************
+Description : Write back and invalidate all caches. This function needs to be
+              adapted to your specific hardware.
+Input       : None.
+Output      : None.
+Return      : None.
+******************************************************************************/
+void Cache_Flush(void)
+{
+    /* No cache - the flash is zero-wait up to the configured boundary */
+}
+/* End Function:Cache_Flush **************************************************/
+
 /* Function:Int_Print *********************************************************
 Description : Print a signed integer on the debugging console. This integer is
               printed as decimal with sign.
@@ -26,7 +26,37 @@ extern uint32_t SystemCoreClock;
 #define configUSE_ALTERNATIVE_API                       0                       /* 已弃用!!! */
 #define configQUEUE_REGISTRY_SIZE                       8                       /* 定义可以注册的信号量和消息队列的个数, 默认: 0 */
 #define configUSE_QUEUE_SETS                            1                       /* 1: 使能队列集, 默认: 0 */
+#ifndef configUSE_TIME_SLICING
 #define configUSE_TIME_SLICING                          0                       /* 1: 使能时间片调度, 默认: 1 */
+#endif
+/* The ISR phase breakdown timestamps every switch, which the other tests
+ * would pay for, so it is only in with BENCH_PHASE */
+#ifdef BENCH_PHASE
+extern void Phase_Switch_Mark(void);
+#define traceTASK_SWITCHED_IN()                         Phase_Switch_Mark()
+#endif
+/* The critical section profiler lengthens every masked window a little, so
+ * it is likewise only in with BENCH_CRIT */
+#ifdef BENCH_CRIT
+extern void Crit_Enter(const char* File, unsigned int Line);
+extern void Crit_Exit(void);
+#define traceCRITICAL_ENTER()                           Crit_Enter(__FILE__,__LINE__)
+#define traceCRITICAL_EXIT()                            Crit_Exit()
+#endif
+/* The allocation trace logs every pvPortMalloc and vPortFree with its caller,
+ * which would skew the heap tests, so it is only in with BENCH_TRACE */
+#ifdef BENCH_TRACE
+extern void Trace_Malloc(void* Addr, unsigned int Size, void* Site);
+extern void Trace_Free(void* Addr, void* Site);
+/* The hooks expand inside pvPortMalloc and vPortFree, so this is their caller */
+#if defined(__CC_ARM)
+#define TRACE_SITE()                                    ((void*)__return_address())
+#else
+#define TRACE_SITE()                                    __builtin_return_address(0)
+#endif
+#define traceMALLOC(pvAddress,uiSize)                   Trace_Malloc((pvAddress),(unsigned int)(uiSize),TRACE_SITE())
+#define traceFREE(pvAddress,uiSize)                     Trace_Free((pvAddress),TRACE_SITE())
+#endif
 #define configUSE_NEWLIB_REENTRANT                      0                       /* 1: 任务创建时分配Newlib的重入结构体, 默认: 0 */
 #define configENABLE_BACKWARD_COMPATIBILITY             0                       /* 1: 使能兼容老版本, 默认: 1 */
 #define configNUM_THREAD_LOCAL_STORAGE_POINTERS         0                       /* 定义线程本地存储指针的个数, 默认: 0 */
@@ -34,14 +64,14 @@ extern uint32_t SystemCoreClock;
 #define configMESSAGE_BUFFER_LENGTH_TYPE                size_t                  /* 定义消息缓冲区中消息长度的数据类型, 默认: size_t */
 
 /* 内存分配相关定义 */
-#define configSUPPORT_STATIC_ALLOCATION                 0                       /* 1: 支持静态申请内存, 默认: 0 */
+#define configSUPPORT_STATIC_ALLOCATION                 1                       /* 1: 支持静态申请内存, 默认: 0 */
 #define configSUPPORT_DYNAMIC_ALLOCATION                1                       /* 1: 支持动态申请内存, 默认: 1 */
 #define configTOTAL_HEAP_SIZE                           ((size_t)(72 * 1024))   /* FreeRTOS堆中可用的RAM总量, 单位: Byte, 无默认需定义 */
 #define configAPPLICATION_ALLOCATED_HEAP                0                       /* 1: 用户手动分配FreeRTOS内存堆(ucHeap), 默认: 0 */
 #define configSTACK_ALLOCATION_FROM_SEPARATE_HEAP       0                       /* 1: 用户自行实现任务创建时使用的内存申请与释放函数, 默认: 0 */
 
 /* 钩子函数相关定义 */
-#define configUSE_IDLE_HOOK                             0                       /* 1: 使能空闲任务钩子函数, 无默认需定义  */
+#define configUSE_IDLE_HOOK                             1                       /* 1: 使能空闲任务钩子函数, 无默认需定义  */
 #define configUSE_TICK_HOOK                             0                       /* 1: 使能系统时钟节拍中断钩子函数, 无默认需定义 */
 #define configCHECK_FOR_STACK_OVERFLOW                  0                       /* 1: 使能栈溢出检测方法1, 2: 使能栈溢出检测方法2, 默认: 0 */
 #define configUSE_MALLOC_FAILED_HOOK                    0                       /* 1: 使能动态内存申请失败钩子函数, 默认: 0 */
@@ -63,9 +93,9 @@ extern uint32_t FreeRTOSRunTimeTicks;
 #define configMAX_CO_ROUTINE_PRIORITIES                 2                       /* 定义协程的最大优先级, 最大优先级=configMAX_CO_ROUTINE_PRIORITIES-1, 无默认configUSE_CO_ROUTINES为1时需定义 */
 
 /* 软件定时器相关定义 */
-#define configUSE_TIMERS                                0                               /* 1: 使能软件定时器, 默认: 0 */
+#define configUSE_TIMERS                                1                               /* 1: 使能软件定时器, 默认: 0 */
 #define configTIMER_TASK_PRIORITY                       ( configMAX_PRIORITIES - 1 )    /* 定义软件定时器任务的优先级, 无默认configUSE_TIMERS为1时需定义 */
-#define configTIMER_QUEUE_LENGTH                        5                               /* 定义软件定时器命令队列的长度, 无默认configUSE_TIMERS为1时需定义 */
+#define configTIMER_QUEUE_LENGTH                        8                               /* 定义软件定时器命令队列的长度, 无默认configUSE_TIMERS为1时需定义 */
 #define configTIMER_TASK_STACK_DEPTH                    ( configMINIMAL_STACK_SIZE * 2) /* 定义软件定时器任务的栈空间大小, 无默认configUSE_TIMERS为1时需定义 */
 
 /* 可选函数, 1: 使能 */
@@ -82,7 +112,7 @@ extern uint32_t FreeRTOSRunTimeTicks;
 #define INCLUDE_xTaskGetIdleTaskHandle                  1                       /* 获取空闲任务的任务句柄 */
 #define INCLUDE_eTaskGetState                           1                       /* 获取任务状态 */
 #define INCLUDE_xEventGroupSetBitFromISR                1                       /* 在中断中设置事件标志位 */
-#define INCLUDE_xTimerPendFunctionCall                  0                       /* 将函数的执行挂到定时器服务任务 */
+#define INCLUDE_xTimerPendFunctionCall                  1                       /* 将函数的执行挂到定时器服务任务 */
 #define INCLUDE_xTaskAbortDelay                         1                       /* 中断任务延时 */
 #define INCLUDE_xTaskGetHandle                          1                       /* 通过任务名获取任务句柄 */
 #define INCLUDE_xTaskResumeFromISR                      1                       /* 恢复在中断中挂起的任务 */
@@ -15,6 +15,22 @@ Description : FreeRTOS init functions.
 /* End Include ***************************************************************/
 
 /* Define ********************************************************************/
+/* Board name reported in the structured output */
+#define TEST_BOARD              "STM32F767IG"
+/* Counter read wrapper - DWT cycle counter */
+#define TEST_CNT_READ()         (DWT->CYCCNT)
+/* Cycles since the periodic interrupt was raised - TIM4 counts down from ARR
+ * at half the CPU clock */
+#define TEST_INT_LATENCY()      ((TIM4->ARR-TIM4->CNT)*2U)
+/* The interrupt storm sources - the raw one above the kernel, the other at
+ * the highest priority that may call it, both above the periodic interrupt */
+#define TEST_STORM
+#ifndef BENCH_STORM_PRIO_RAW
+#define BENCH_STORM_PRIO_RAW    (2U)
+#endif
+#ifndef BENCH_STORM_PRIO_API
+#define BENCH_STORM_PRIO_API    configLIBRARY_MAX_SYSCALL_INTERRUPT_PRIORITY
+#endif
 #define Print_Int(INT)          Int_Print((int)(INT))
 #define Print_Str(STR)          Str_Print((const signed char*)(STR))
 
@@ -29,8 +45,11 @@ while(0)
 
 /* Global ********************************************************************/
 void Int_Handler(void);
-TIM_HandleTypeDef TIM2_Handle={0};
+void Storm_Raw_Handler(void);
+void Storm_Api_Handler(void);
 TIM_HandleTypeDef TIM4_Handle={0};
+TIM_HandleTypeDef TIM3_Handle={0};
+TIM_HandleTypeDef TIM5_Handle={0};
 /* End Global ****************************************************************/
 
 /* Function:Low_Lvl_Init ******************************************************
@@ -124,18 +143,29 @@ Return      : None.
 ******************************************************************************/
 void Timer_Init(void)
 {
-    /* TIM2 clock = 1/2 CPU clock */
-    TIM2_Handle.Instance=TIM2;
-    TIM2_Handle.Init.Prescaler=0;
-    TIM2_Handle.Init.CounterMode=TIM_COUNTERMODE_UP;
-    TIM2_Handle.Init.Period=(unsigned int)(-1);
-    TIM2_Handle.Init.ClockDivision=TIM_CLOCKDIVISION_DIV1;
-    HAL_TIM_Base_Init(&TIM2_Handle);
-    __HAL_RCC_TIM2_CLK_ENABLE();
-    __HAL_TIM_ENABLE(&TIM2_Handle);
+    /* DWT cycle counter clock = CPU clock */
+    CoreDebug->DEMCR|=CoreDebug_DEMCR_TRCENA_Msk;
+    /* The CM7 DWT is software-locked out of reset */
+    DWT->LAR=0xC5ACCE55U;
+    DWT->CYCCNT=0U;
+    DWT->CTRL|=DWT_CTRL_CYCCNTENA_Msk;
 }
 /* End Function:Timer_Init ***************************************************/
 
+/* Function:Tick_Disable ******************************************************
+Description : Disable the kernel tick source. This function needs to be adapted
+              to your specific hardware.
+Input       : None.
+Output      : None.
+Return      : None.
+******************************************************************************/
+void Tick_Disable(void)
+{
+    SysTick->CTRL=0x00U;
+    SysTick->VAL=0x00U;
+}
+/* End Function:Tick_Disable *************************************************/
+
 /* Function:Int_Init **********************************************************
 Description : Initialize an periodic interrupt source. This function needs
               to be adapted to your specific hardware.
@@ -195,6 +225,95 @@ void Int_Disable(void)
 }
 /* End Function:Int_Disable **************************************************/
 
+#ifdef BENCH_STORM
+/* Function:Storm_Init ********************************************************
+Description : Start the two interrupt storm sources. This function needs to
+              be adapted to your specific hardware.
+Input       : uint32_t Raw_Hz - The rate of the source above the kernel.
+              uint32_t Api_Hz - The rate of the source calling the kernel.
+Output      : None.
+Return      : None.
+******************************************************************************/
+void Storm_Init(uint32_t Raw_Hz, uint32_t Api_Hz)
+{
+    /* TIM3 and TIM5 clock = 1/2 CPU clock; TIM3 is only 16-bit,
+     * so no slower than 1.7kHz */
+    __HAL_RCC_TIM3_CLK_ENABLE();
+    __HAL_RCC_TIM5_CLK_ENABLE();
+    TIM3_Handle.Instance=TIM3;
+    TIM3_Handle.Init.Prescaler=0;
+    TIM3_Handle.Init.CounterMode=TIM_COUNTERMODE_DOWN;
+    TIM3_Handle.Init.Period=(SystemCoreClock/2U)/Raw_Hz-1U;
+    TIM3_Handle.Init.ClockDivision=TIM_CLOCKDIVISION_DIV1;
+    TIM3_Handle.Init.RepetitionCounter=0;
+    HAL_TIM_Base_Init(&TIM3_Handle);
+    __HAL_TIM_CLEAR_IT(&TIM3_Handle, TIM_IT_UPDATE);
+    TIM5_Handle.Instance=TIM5;
+    TIM5_Handle.Init.Prescaler=0;
+    TIM5_Handle.Init.CounterMode=TIM_COUNTERMODE_DOWN;
+    TIM5_Handle.Init.Period=(SystemCoreClock/2U)/Api_Hz-1U;
+    TIM5_Handle.Init.ClockDivision=TIM_CLOCKDIVISION_DIV1;
+    TIM5_Handle.Init.RepetitionCounter=0;
+    HAL_TIM_Base_Init(&TIM5_Handle);
+    __HAL_TIM_CLEAR_IT(&TIM5_Handle, TIM_IT_UPDATE);
+    
+    NVIC_SetPriority(TIM3_IRQn,BENCH_STORM_PRIO_RAW);
+    NVIC_SetPriority(TIM5_IRQn,BENCH_STORM_PRIO_API);
+    NVIC_EnableIRQ(TIM3_IRQn);
+    NVIC_EnableIRQ(TIM5_IRQn);
+    HAL_TIM_Base_Start_IT(&TIM3_Handle);
+    HAL_TIM_Base_Start_IT(&TIM5_Handle);
+}
+
+/* The interrupt handlers */
+void TIM3_IRQHandler(void)
+{
+    TIM3->SR=~TIM_FLAG_UPDATE;
+    Storm_Raw_Handler();
+}
+
+void TIM5_IRQHandler(void)
+{
+    TIM5->SR=~TIM_FLAG_UPDATE;
+    Storm_Api_Handler();
+}
+/* End Function:Storm_Init ***************************************************/
+
+/* Function:Storm_Disable *****************************************************
+Description : Stop the two interrupt storm sources. This function needs to be
+              adapted to your specific hardware.
+Input       : None.
+Output      : None.
+Return      : None.
+******************************************************************************/
+void Storm_Disable(void)
+{
+    NVIC_DisableIRQ(TIM3_IRQn);
+    NVIC_DisableIRQ(TIM5_IRQn);
+    HAL_TIM_Base_Stop_IT(&TIM3_Handle);
+    HAL_TIM_Base_Stop_IT(&TIM5_Handle);
+}
+/* End Function:Storm_Disable ************************************************/
+#endif
+
+/* Function:Cache_Flush *******************************************************
+Description : Write back and invalidate all caches. This function needs to be
+              adapted to your specific hardware.
+Input       : None.
+Output      : None.
+Return      : None.
+******************************************************************************/
+void Cache_Flush(void)
+{
+    SCB_CleanInvalidateDCache();
+    SCB_InvalidateICache();
+    /* The ART accelerator can only be reset while it is off */
+    __HAL_FLASH_ART_DISABLE();
+    __HAL_FLASH_ART_RESET();
+    __HAL_FLASH_ART_ENABLE();
+}
+/* End Function:Cache_Flush **************************************************/
+
 /* Function:Int_Print *********************************************************
 Description : Print a signed integer on the debugging console. This integer is
               printed as decimal with sign.
@@ -90,13 +90,14 @@
 #endif
 
 #define configUSE_PREEMPTION			1
-#define configUSE_IDLE_HOOK				0
+#define configUSE_IDLE_HOOK				1
 #define configUSE_TICK_HOOK				0
 #define configCPU_CLOCK_HZ				( 2000000U )
 #define configTICK_RATE_HZ				( ( TickType_t ) 1000 )
 #define configMAX_PRIORITIES			( 5 )
 #define configMINIMAL_STACK_SIZE		( ( unsigned short ) 60 )
 #define configTOTAL_HEAP_SIZE			( ( size_t ) ( 8 * 1024 ) )
+#define configSUPPORT_STATIC_ALLOCATION	1
 #define configMAX_TASK_NAME_LEN			( 5 )
 #define configUSE_TRACE_FACILITY		1
 #define configUSE_16_BIT_TICKS			0
@@ -116,8 +117,8 @@
 
 /* Software timer definitions. */
 #define configUSE_TIMERS				1
-#define configTIMER_TASK_PRIORITY		( 2 )
-#define configTIMER_QUEUE_LENGTH		5
+#define configTIMER_TASK_PRIORITY		( configMAX_PRIORITIES - 1 )
+#define configTIMER_QUEUE_LENGTH		8
 #define configTIMER_TASK_STACK_DEPTH	( 80 )
 
 /* Set the following definitions to 1 to include the API function, or zero
@@ -127,8 +128,13 @@ to exclude the API function. */
 #define INCLUDE_vTaskDelete				1
 #define INCLUDE_vTaskCleanUpResources	1
 #define INCLUDE_vTaskSuspend			1
+#define INCLUDE_eTaskGetState			1
+#define INCLUDE_xTaskGetCurrentTaskHandle	1
+#define INCLUDE_xTaskGetSchedulerState	1
 #define INCLUDE_vTaskDelayUntil			1
 #define INCLUDE_vTaskDelay				1
+#define INCLUDE_xTimerPendFunctionCall	1
+#define INCLUDE_xTaskAbortDelay			1
 
 /* Normal assert() semantics without relying on the provision of an assert.h
 header file. */
@@ -141,7 +147,37 @@ standard names - or at least those used in the unmodified vector table. */
 #define xPortSysTickHandler SysTick_Handler
 
 /* Close time slice schedule */
+#ifndef configUSE_TIME_SLICING
 #define configUSE_TIME_SLICING                          0
+#endif
+/* The ISR phase breakdown timestamps every switch, which the other tests
+ * would pay for, so it is only in with BENCH_PHASE */
+#ifdef BENCH_PHASE
+extern void Phase_Switch_Mark(void);
+#define traceTASK_SWITCHED_IN()                         Phase_Switch_Mark()
+#endif
+/* The critical section profiler lengthens every masked window a little, so
+ * it is likewise only in with BENCH_CRIT */
+#ifdef BENCH_CRIT
+extern void Crit_Enter(const char* File, unsigned int Line);
+extern void Crit_Exit(void);
+#define traceCRITICAL_ENTER()                           Crit_Enter(__FILE__,__LINE__)
+#define traceCRITICAL_EXIT()                            Crit_Exit()
+#endif
+/* The allocation trace logs every pvPortMalloc and vPortFree with its caller,
+ * which would skew the heap tests, so it is only in with BENCH_TRACE */
+#ifdef BENCH_TRACE
+extern void Trace_Malloc(void* Addr, unsigned int Size, void* Site);
+extern void Trace_Free(void* Addr, void* Site);
+/* The hooks expand inside pvPortMalloc and vPortFree, so this is their caller */
+#if defined(__CC_ARM)
+#define TRACE_SITE()                                    ((void*)__return_address())
+#else
+#define TRACE_SITE()                                    __builtin_return_address(0)
+#endif
+#define traceMALLOC(pvAddress,uiSize)                   Trace_Malloc((pvAddress),(unsigned int)(uiSize),TRACE_SITE())
+#define traceFREE(pvAddress,uiSize)                     Trace_Free((pvAddress),TRACE_SITE())
+#endif
 /* Disable stack overflow detection */
 #define configCHECK_FOR_STACK_OVERFLOW                  0
 /* Disable hook function when Malloc fails */
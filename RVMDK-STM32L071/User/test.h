@@ -15,12 +15,38 @@ Description : FreeRTOS init functions.
 /* End Include ***************************************************************/
 
 /* Define ********************************************************************/
+/* Board name reported in the structured output */
+#define TEST_BOARD              "STM32L071CB"
 #define Print_Int(INT)          Int_Print((int)(INT))
 #define Print_Str(STR)          Str_Print((const signed char*)(STR))
-/* Counter read wrapper */
-#define TEST_CNT_READ()    			((uint16_t)(TIM2->CNT))
-/* Memory pool test switch */
-/* #define TEST_MEM_POOL */
+/* Counter read wrapper - there is no cycle counter on ARMv6-M, so SysTick is
+ * reused once the kernel tick is off. It counts down, hence the inversion */
+#define TEST_CNT_READ()         ((~(SysTick->VAL))&0x00FFFFFFU)
+/* Cycles since the periodic interrupt was raised - TIM21 counts down from ARR
+ * at the CPU clock */
+#define TEST_INT_LATENCY()      (TIM21->ARR-TIM21->CNT)
+/* SysTick is only 24 bits wide */
+#define TEST_CNT_MASK           (0x00FFFFFFU)
+/* Not enough RAM for the memory pool test */
+#define TEST_MEM_POOL_NONE
+/* Samples above 2^20 cycles share the last bucket, to save RAM */
+#define HIST_VAL_BITS           (20U)
+/* Up to 8 tasks in the scaling tests, to fit the heap */
+#define BENCH_HELPER_NUM        (7U)
+#define BENCH_TIMER_NUM         (16U)
+/* A shorter allocation trace, for BENCH_TRACE */
+#ifndef BENCH_TRACE_NUM
+#define BENCH_TRACE_NUM         (64U)
+#endif
+/* The interrupt storm sources - the Cortex-M0+ masks every interrupt in a
+ * critical section, so the raw one is only above the kernel's own ISRs */
+#define TEST_STORM
+#ifndef BENCH_STORM_PRIO_RAW
+#define BENCH_STORM_PRIO_RAW    (0U)
+#endif
+#ifndef BENCH_STORM_PRIO_API
+#define BENCH_STORM_PRIO_API    (1U)
+#endif
 
 #define PUTCHAR(CHAR) \
 do \
@@ -33,8 +59,11 @@ while(0)
 
 /* Global ********************************************************************/
 void Int_Handler(void);
-TIM_HandleTypeDef TIM2_Handle={0};
+void Storm_Raw_Handler(void);
+void Storm_Api_Handler(void);
 TIM_HandleTypeDef TIM21_Handle={0};
+TIM_HandleTypeDef TIM2_Handle={0};
+TIM_HandleTypeDef TIM22_Handle={0};
 /* End Global ****************************************************************/
 
 /* Function:Low_Lvl_Init ******************************************************
@@ -113,18 +142,28 @@ Return      : None.
 ******************************************************************************/
 void Timer_Init(void)
 {
-    /* TIM2 clock = CPU clock */
-    TIM2_Handle.Instance=TIM2;
-    TIM2_Handle.Init.Prescaler=0;
-    TIM2_Handle.Init.CounterMode=TIM_COUNTERMODE_UP;
-    TIM2_Handle.Init.Period=(uint16_t)(-1);
-    TIM2_Handle.Init.ClockDivision=TIM_CLOCKDIVISION_DIV1;
-    HAL_TIM_Base_Init(&TIM2_Handle);
-    __HAL_RCC_TIM2_CLK_ENABLE();
-    __HAL_TIM_ENABLE(&TIM2_Handle);
+    /* SysTick is still the kernel tick here; Tick_Disable starts the counter */
 }
 /* End Function:Timer_Init ***************************************************/
 
+/* Function:Tick_Disable ******************************************************
+Description : Disable the kernel tick source, and turn SysTick into the free-
+              running timestamp counter. This function needs to be adapted to
+              your specific hardware.
+Input       : None.
+Output      : None.
+Return      : None.
+******************************************************************************/
+void Tick_Disable(void)
+{
+    /* SysTick clock = CPU clock, full 24-bit range, no interrupt */
+    SysTick->CTRL=0x00U;
+    SysTick->LOAD=0x00FFFFFFU;
+    SysTick->VAL=0x00U;
+    SysTick->CTRL=SysTick_CTRL_CLKSOURCE_Msk|SysTick_CTRL_ENABLE_Msk;
+}
+/* End Function:Tick_Disable *************************************************/
+
 /* Function:Int_Init **********************************************************
 Description : Initialize an periodic interrupt source. This function needs
               to be adapted to your specific hardware.
@@ -183,6 +222,89 @@ void Int_Disable(void)
 }
 /* End Function:Int_Disable **************************************************/
 
+#ifdef BENCH_STORM
+/* Function:Storm_Init ********************************************************
+Description : Start the two interrupt storm sources. This function needs to
+              be adapted to your specific hardware.
+Input       : uint32_t Raw_Hz - The rate of the source above the kernel.
+              uint32_t Api_Hz - The rate of the source calling the kernel.
+Output      : None.
+Return      : None.
+******************************************************************************/
+void Storm_Init(uint32_t Raw_Hz, uint32_t Api_Hz)
+{
+    /* TIM2 and TIM22 clock = CPU clock; both are only 16-bit, so no
+     * slower than 500Hz */
+    __HAL_RCC_TIM2_CLK_ENABLE();
+    __HAL_RCC_TIM22_CLK_ENABLE();
+    TIM2_Handle.Instance=TIM2;
+    TIM2_Handle.Init.Prescaler=0;
+    TIM2_Handle.Init.CounterMode=TIM_COUNTERMODE_DOWN;
+    TIM2_Handle.Init.Period=SystemCoreClock/Raw_Hz-1U;
+    TIM2_Handle.Init.ClockDivision=TIM_CLOCKDIVISION_DIV1;
+    HAL_TIM_Base_Init(&TIM2_Handle);
+    __HAL_TIM_CLEAR_IT(&TIM2_Handle, TIM_IT_UPDATE);
+    TIM22_Handle.Instance=TIM22;
+    TIM22_Handle.Init.Prescaler=0;
+    TIM22_Handle.Init.CounterMode=TIM_COUNTERMODE_DOWN;
+    TIM22_Handle.Init.Period=SystemCoreClock/Api_Hz-1U;
+    TIM22_Handle.Init.ClockDivision=TIM_CLOCKDIVISION_DIV1;
+    HAL_TIM_Base_Init(&TIM22_Handle);
+    __HAL_TIM_CLEAR_IT(&TIM22_Handle, TIM_IT_UPDATE);
+    
+    NVIC_SetPriority(TIM2_IRQn,BENCH_STORM_PRIO_RAW);
+    NVIC_SetPriority(TIM22_IRQn,BENCH_STORM_PRIO_API);
+    NVIC_EnableIRQ(TIM2_IRQn);
+    NVIC_EnableIRQ(TIM22_IRQn);
+    HAL_TIM_Base_Start_IT(&TIM2_Handle);
+    HAL_TIM_Base_Start_IT(&TIM22_Handle);
+}
+
+/* The interrupt handlers */
+void TIM2_IRQHandler(void)
+{
+    TIM2->SR=~TIM_FLAG_UPDATE;
+    Storm_Raw_Handler();
+}
+
+void TIM22_IRQHandler(void)
+{
+    TIM22->SR=~TIM_FLAG_UPDATE;
+    Storm_Api_Handler();
+}
+/* End Function:Storm_Init ***************************************************/
+
+/* Function:Storm_Disable *****************************************************
+Description : Stop the two interrupt storm sources. This function needs to be
+              adapted to your specific hardware.
+Input       : None.
+Output      : None.
+Return      : None.
+******************************************************************************/
+void Storm_Disable(void)
+{
+    NVIC_DisableIRQ(TIM2_IRQn);
+    NVIC_DisableIRQ(TIM22_IRQn);
+    HAL_TIM_Base_Stop_IT(&TIM2_Handle);
+    HAL_TIM_Base_Stop_IT(&TIM22_Handle);
+}
+/* End Function:Storm_Disable ************************************************/
+#endif
+
+/* Function:Cache_Flush *******************************************************
+Description : Write back and invalidate all caches. This function needs to be
+              adapted to your specific hardware.
+Input       : None.
+Output      : None.
+Return      : None.
+******************************************************************************/
+void Cache_Flush(void)
+{
+    /* There is only the flash prefetch buffer, which holds no state worth
+     * flushing */
+}
+/* End Function:Cache_Flush **************************************************/
+
 /* Function:Int_Print *********************************************************
 Description : Print a signed integer on the debugging console. This integer is
               printed as decimal with sign.
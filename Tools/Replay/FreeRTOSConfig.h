@@ -0,0 +1,26 @@
+#ifndef FREERTOS_CONFIG_H
+#define FREERTOS_CONFIG_H
+
+/* The allocation replay only builds one heap_x.c against this, with the
+ * scheduler calls stubbed out in replay.c; nothing else here is used */
+#include <stdint.h>
+#include <assert.h>
+
+#ifndef REPLAY_HEAP_SIZE
+#define REPLAY_HEAP_SIZE                                (72 * 1024)
+#endif
+
+#define configUSE_PREEMPTION                            1
+#define configUSE_IDLE_HOOK                             0
+#define configUSE_TICK_HOOK                             0
+#define configUSE_16_BIT_TICKS                          0
+#define configMAX_PRIORITIES                            32
+#define configMINIMAL_STACK_SIZE                        128
+#define configMAX_TASK_NAME_LEN                         16
+#define configUSE_MALLOC_FAILED_HOOK                    0
+#define configSUPPORT_DYNAMIC_ALLOCATION                1
+#define configTOTAL_HEAP_SIZE                           ((size_t)(REPLAY_HEAP_SIZE))
+
+#define configASSERT(x)                                 assert(x)
+
+#endif
@@ -0,0 +1,443 @@
+/******************************************************************************
+Filename    : replay.c
+Author      : hrs
+Date        : 17/10/2026
+Licence     : The Unlicense; see LICENSE for details.
+Description : Host-side replay of the allocation trace that the benchmark
+              dumps when built with BENCH_TRACE. The makefile links this with
+              each of heap_1.c to heap_5.c in turn, and every binary replays
+              the same trace natively, reporting the malloc and free latency,
+              the peak usage and the fragmentation of that heap.
+
+              ./replay_heap_4 LOG
+
+              The trace holds the sizes that the device heap looked for, which
+              include its block header; that header is given in the heading
+              and taken off, so the replaying heap adds its own.
+******************************************************************************/
+
+/* Include *******************************************************************/
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include "FreeRTOS.h"
+#include "task.h"
+/* End Include ***************************************************************/
+
+/* Define ********************************************************************/
+#ifndef REPLAY_HEAP
+#define REPLAY_HEAP             (4U)
+#endif
+#define TRACE_FREE              (1U<<31)
+#define TRACE_SIZE(INFO)        ((INFO)&0xFFFFFFU)
+
+/* One trace record, as printed by Trace_Print */
+struct Trace_Struct
+{
+    uint32_t Tick;
+    uint32_t Site;
+    uint32_t Addr;
+    uint32_t Info;
+};
+
+/* A block that the trace allocated and has not freed yet */
+struct Live_Struct
+{
+    uint32_t Addr;
+    void* Ptr;
+    size_t Size;
+};
+/* End Define ****************************************************************/
+
+/* Global ********************************************************************/
+struct Trace_Struct* Trace;
+uint32_t Trace_Num;
+uint32_t Trace_Header;
+uint32_t Trace_Heap;
+
+struct Live_Struct* Live;
+uint32_t Live_Num;
+
+/* Latency of every malloc and free, in ns */
+uint32_t* Malloc_Lat;
+uint32_t Malloc_Num;
+uint32_t* Free_Lat;
+uint32_t Free_Num;
+
+uint32_t Fail;
+uint32_t Trace_Fail;
+uint32_t Unmatched;
+size_t Live_Bytes;
+size_t Live_Peak;
+size_t Free_Total;
+size_t Free_Min;
+/* Largest/total free, in hundredths of a percent */
+uint32_t Frag_Worst;
+
+#if(REPLAY_HEAP==5U)
+/* heap_5 gets the whole heap as one region, to compare with the others */
+static uint8_t Heap_Mem[configTOTAL_HEAP_SIZE] __attribute__((aligned(portBYTE_ALIGNMENT)));
+static const HeapRegion_t Heap_Region[]=
+{
+    {Heap_Mem,sizeof(Heap_Mem)},
+    {NULL,0U}
+};
+#endif
+/* End Global ****************************************************************/
+
+/* Function:vTaskSuspendAll ***************************************************
+Description : The scheduler stubs that the heaps call. The replay has only
+              the one thread, so they do nothing.
+Input       : None.
+Output      : None.
+Return      : BaseType_t - Always pdFALSE, for xTaskResumeAll.
+******************************************************************************/
+void vTaskSuspendAll(void)
+{
+}
+
+BaseType_t xTaskResumeAll(void)
+{
+    return pdFALSE;
+}
+/* End Function:vTaskSuspendAll **********************************************/
+
+/* Function:Trace_Load ********************************************************
+Description : Read the trace from the console log. Everything other than the
+              heading and the records that follow it is skipped, so the whole
+              benchmark output can be given.
+Input       : const char* Path - The log.
+Output      : None.
+Return      : int - 0 if a trace was found, -1 if not.
+******************************************************************************/
+int Trace_Load(const char* Path)
+{
+    FILE* File;
+    char Line[256];
+    const char* Pos;
+    unsigned long Num;
+    unsigned long Total;
+    unsigned int Heap;
+    unsigned int Header;
+    unsigned int Word[4];
+    int Found;
+
+    File=fopen(Path,"r");
+    if(File==NULL)
+    {
+        perror(Path);
+        return -1;
+    }
+
+    Found=0;
+    while(fgets(Line,sizeof(Line),File)!=NULL)
+    {
+        if(Found==0)
+        {
+            if(strncmp(Line,"Allocation trace ",17)!=0)
+                continue;
+            Pos=strchr(Line,':');
+            if((Pos==NULL)||
+               (sscanf(Pos+1," %lu records of %lu, heap_%u, header %u",&Num,&Total,&Heap,&Header)!=4))
+                continue;
+            Trace=calloc(Num+1U,sizeof(struct Trace_Struct));
+            if(Trace==NULL)
+                break;
+            Trace_Heap=Heap;
+            Trace_Header=Header;
+            Found=1;
+            continue;
+        }
+
+        if(strncmp(Line,"Allocation trace end",20)==0)
+            break;
+        if(sscanf(Line,"T:%x %x %x %x",&Word[0],&Word[1],&Word[2],&Word[3])!=4)
+            continue;
+        if(Trace_Num>=Num)
+            break;
+        Trace[Trace_Num].Tick=Word[0];
+        Trace[Trace_Num].Site=Word[1];
+        Trace[Trace_Num].Addr=Word[2];
+        Trace[Trace_Num].Info=Word[3];
+        Trace_Num++;
+    }
+
+    fclose(File);
+    if(Found==0)
+    {
+        fprintf(stderr,"%s: no allocation trace - build with TRACE=1.\n",Path);
+        return -1;
+    }
+    return 0;
+}
+/* End Function:Trace_Load ***************************************************/
+
+/* Function:Nano_Get **********************************************************
+Description : Read the monotonic clock.
+Input       : None.
+Output      : None.
+Return      : uint64_t - The time, in ns.
+******************************************************************************/
+uint64_t Nano_Get(void)
+{
+    struct timespec Now;
+
+    clock_gettime(CLOCK_MONOTONIC,&Now);
+    return ((uint64_t)Now.tv_sec)*1000000000U+(uint64_t)Now.tv_nsec;
+}
+/* End Function:Nano_Get *****************************************************/
+
+/* Function:Heap_Sample *******************************************************
+Description : Track the free space and its fragmentation after an operation.
+              heap_1 never splits its free space, and heap_3 keeps no count.
+Input       : None.
+Output      : None.
+Return      : None.
+******************************************************************************/
+void Heap_Sample(void)
+{
+#if(REPLAY_HEAP!=3U)
+    size_t Free;
+    size_t Largest;
+    uint32_t Frag;
+
+    Free=xPortGetFreeHeapSize();
+#if(REPLAY_HEAP==1U)
+    Largest=Free;
+#else
+    Largest=xPortGetLargestFreeBlockSize();
+#endif
+    if(Free<Free_Min)
+        Free_Min=Free;
+    Frag=(Free==0U)?10000U:(uint32_t)((((uint64_t)Largest)*10000U)/Free);
+    if(Frag<Frag_Worst)
+        Frag_Worst=Frag;
+#endif
+}
+/* End Function:Heap_Sample **************************************************/
+
+/* Function:Replay_Malloc *****************************************************
+Description : Replay one allocation.
+Input       : const struct Trace_Struct* Rec - The record.
+Output      : None.
+Return      : None.
+******************************************************************************/
+void Replay_Malloc(const struct Trace_Struct* Rec)
+{
+    size_t Size;
+    void* Ptr;
+    uint64_t Start;
+    uint64_t End;
+
+    /* The device asked for at least this much */
+    Size=TRACE_SIZE(Rec->Info);
+    Size=(Size>Trace_Header)?(Size-Trace_Header):1U;
+    if(Rec->Addr==0U)
+        Trace_Fail++;
+
+    Start=Nano_Get();
+    Ptr=pvPortMalloc(Size);
+    End=Nano_Get();
+    Malloc_Lat[Malloc_Num++]=(uint32_t)(End-Start);
+
+    if(Ptr==NULL)
+    {
+        Fail++;
+        return;
+    }
+    /* Failed on the device means there is no free to match it */
+    if(Rec->Addr==0U)
+        return;
+
+    Live[Live_Num].Addr=Rec->Addr;
+    Live[Live_Num].Ptr=Ptr;
+    Live[Live_Num].Size=Size;
+    Live_Num++;
+    Live_Bytes+=Size;
+    if(Live_Bytes>Live_Peak)
+        Live_Peak=Live_Bytes;
+}
+/* End Function:Replay_Malloc ************************************************/
+
+/* Function:Replay_Free *******************************************************
+Description : Replay one free. Frees of blocks allocated before the oldest
+              record, or that failed here, have nothing to match and are only
+              counted. heap_1 cannot free, so its blocks are only forgotten.
+Input       : const struct Trace_Struct* Rec - The record.
+Output      : None.
+Return      : None.
+******************************************************************************/
+void Replay_Free(const struct Trace_Struct* Rec)
+{
+    uint32_t Count;
+    void* Ptr;
+    uint64_t Start;
+    uint64_t End;
+
+    for(Count=0U;Count<Live_Num;Count++)
+    {
+        if(Live[Count].Addr==Rec->Addr)
+            break;
+    }
+    if(Count==Live_Num)
+    {
+        Unmatched++;
+        return;
+    }
+
+    Ptr=Live[Count].Ptr;
+    Live_Bytes-=Live[Count].Size;
+    Live_Num--;
+    Live[Count]=Live[Live_Num];
+
+#if(REPLAY_HEAP!=1U)
+    Start=Nano_Get();
+    vPortFree(Ptr);
+    End=Nano_Get();
+    Free_Lat[Free_Num++]=(uint32_t)(End-Start);
+#else
+    (void)Ptr;
+    (void)Start;
+    (void)End;
+#endif
+}
+/* End Function:Replay_Free **************************************************/
+
+/* Function:Lat_Print *********************************************************
+Description : Print one latency line in the result format of the benchmark.
+Input       : const char* Name - The name, padded to the colon.
+              uint32_t* Lat - The latencies, sorted here.
+              uint32_t Num - The number of them.
+Output      : None.
+Return      : None.
+******************************************************************************/
+int Lat_Compare(const void* Left, const void* Right)
+{
+    uint32_t Left_Val;
+    uint32_t Right_Val;
+
+    Left_Val=*(const uint32_t*)Left;
+    Right_Val=*(const uint32_t*)Right;
+    return (Left_Val>Right_Val)-(Left_Val<Right_Val);
+}
+
+void Lat_Print(const char* Name, uint32_t* Lat, uint32_t Num)
+{
+    uint32_t Count;
+    uint64_t Sum;
+
+    if(Num==0U)
+    {
+        printf("%s: none\n",Name);
+        return;
+    }
+
+    qsort(Lat,Num,sizeof(uint32_t),Lat_Compare);
+    Sum=0U;
+    for(Count=0U;Count<Num;Count++)
+        Sum+=Lat[Count];
+    printf("%s: %u / %u / %u / P99 %u\n",Name,(unsigned int)(Sum/Num),
+           Lat[Num-1U],Lat[0],Lat[((Num-1U)*99U)/100U]);
+}
+/* End Function:Lat_Print ****************************************************/
+
+/* Function:Percent_Print *****************************************************
+Description : Print a share given in hundredths of a percent.
+Input       : const char* Name - The name, padded to the colon.
+              uint32_t Share - The share.
+Output      : None.
+Return      : None.
+******************************************************************************/
+void Percent_Print(const char* Name, uint32_t Share)
+{
+    printf("%s: %u.%02u%%\n",Name,Share/100U,Share%100U);
+}
+/* End Function:Percent_Print ************************************************/
+
+/* Function:main **************************************************************
+Description : Load the trace, replay it once against the linked heap, then
+              print the results.
+Input       : int argc - The number of arguments.
+              char* argv[] - The arguments; the log is the only one.
+Output      : None.
+Return      : int - 0 on success, 1 if the trace could not be read.
+******************************************************************************/
+int main(int argc, char* argv[])
+{
+    uint32_t Count;
+    const struct Trace_Struct* Rec;
+#if(REPLAY_HEAP!=3U)
+    size_t Largest;
+#endif
+
+    if(argc!=2)
+    {
+        fprintf(stderr,"Usage: %s LOG\n",argv[0]);
+        return 1;
+    }
+    if(Trace_Load(argv[1])!=0)
+        return 1;
+
+    Live=calloc(Trace_Num+1U,sizeof(struct Live_Struct));
+    Malloc_Lat=calloc(Trace_Num+1U,sizeof(uint32_t));
+    Free_Lat=calloc(Trace_Num+1U,sizeof(uint32_t));
+    if((Live==NULL)||(Malloc_Lat==NULL)||(Free_Lat==NULL))
+    {
+        fprintf(stderr,"Out of memory.\n");
+        return 1;
+    }
+
+#if(REPLAY_HEAP==5U)
+    vPortDefineHeapRegions(Heap_Region);
+#endif
+#if((REPLAY_HEAP==2U)||(REPLAY_HEAP==4U))
+    /* These only set themselves up on the first call */
+    vPortFree(pvPortMalloc(1U));
+#endif
+#if(REPLAY_HEAP!=3U)
+    Free_Total=xPortGetFreeHeapSize();
+#endif
+    Free_Min=Free_Total;
+    Frag_Worst=10000U;
+
+    for(Count=0U;Count<Trace_Num;Count++)
+    {
+        Rec=&Trace[Count];
+        if((Rec->Info&TRACE_FREE)!=0U)
+            Replay_Free(Rec);
+        else
+            Replay_Malloc(Rec);
+        Heap_Sample();
+    }
+
+    printf("Allocation replay                  : heap_%u, %u records from heap_%u, header %u\n",
+           REPLAY_HEAP,Trace_Num,Trace_Heap,Trace_Header);
+    Lat_Print("Malloc (ns)                        ",Malloc_Lat,Malloc_Num);
+#if(REPLAY_HEAP!=1U)
+    Lat_Print("Free (ns)                          ",Free_Lat,Free_Num);
+#else
+    printf("Free (ns)                          : skipped - heap_1 cannot free\n");
+#endif
+    printf("    Failed allocations            : %u (%u on the device)\n",Fail,Trace_Fail);
+    printf("    Unmatched frees               : %u\n",Unmatched);
+    printf("    Peak live bytes               : %zu\n",Live_Peak);
+#if(REPLAY_HEAP!=3U)
+    printf("    Peak used bytes               : %zu of %zu\n",Free_Total-Free_Min,Free_Total);
+    printf("    Min ever free bytes           : %zu\n",Free_Min);
+#if(REPLAY_HEAP==1U)
+    Largest=xPortGetFreeHeapSize();
+#else
+    Largest=xPortGetLargestFreeBlockSize();
+#endif
+    Percent_Print("    Largest/total free            ",(xPortGetFreeHeapSize()==0U)?10000U:
+                  (uint32_t)((((uint64_t)Largest)*10000U)/xPortGetFreeHeapSize()));
+    Percent_Print("    Largest/total free, worst     ",Frag_Worst);
+#endif
+    return 0;
+}
+/* End Function:main *********************************************************/
+
+/* End Of File ***************************************************************/
+
+/* Copyright (C) Evo-Devo Instrum. All rights reserved ***********************/
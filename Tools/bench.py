@@ -0,0 +1,347 @@
+#!/usr/bin/env python3
+###############################################################################
+#Filename    : bench.py
+#Author      : hrs
+#Date        : 17/10/2026
+#Licence     : The Unlicense; see LICENSE for details.
+#Description : Host-side result store and regression comparator for the
+#              benchmark. Reads the console output of any target, either the
+#              JSON lines printed with TEST_OUTPUT_JSON or the plain text
+#              table, keeps each run under Results/<board>/, compares runs
+#              against a per-board baseline and redraws the Figures/ charts.
+#
+#              python3 Tools/bench.py record LOG [--board BOARD] [--label L]
+#              python3 Tools/bench.py baseline RUN
+#              python3 Tools/bench.py compare RUN [--baseline RUN]
+#              python3 Tools/bench.py chart RUN [--out PNG]
+#
+#              LOG may be "-" to read from a pipe, for example:
+#              make -C GCCMF-HOST OUTPUT=json run | python3 Tools/bench.py record -
+###############################################################################
+
+# Import ######################################################################
+import argparse
+import json
+import math
+import os
+import re
+import sys
+import time
+# End Import ##################################################################
+
+# Define ######################################################################
+ROOT=os.path.dirname(os.path.dirname(os.path.abspath(__file__)))
+STORE=os.path.join(ROOT,"Results")
+FIGURES=os.path.join(ROOT,"Figures")
+BASELINE="baseline.json"
+
+# Relative slowdown, in percent, that counts as a regression
+THRESHOLD=5.0
+# Welch z score above which a difference is not noise - about p<0.001
+Z_SCORE=3.3
+
+# Short names used on the chart axis
+SHORT={"Notification":"Notify",
+       "Message queue":"Queue",
+       "Memory allocation/free pair":"Memory",
+       "ISR Notification":"ISR Notify",
+       "ISR Message queue":"ISR Queue"}
+
+# Text table lines: "Name : AVG / MAX / MIN" and the percentile line after it
+TEXT_LINE=re.compile(r"^(\S.*?)\s*:\s*(\d+)\s*/\s*(\d+)\s*/\s*(\d+)\s*$")
+# The text header of the cold cache run, and the suffix its tests get
+COLD_HEADER="Cold cache"
+COLD_SUFFIX=" (cold)"
+# The same for the interrupt storm run
+STORM_HEADER="Interrupt storm"
+STORM_SUFFIX=" (storm)"
+TEXT_PCT=re.compile(r"^\s+P50 / P90 / P99 / P99\.9 / MAX\s*:\s*(\d+)\s*/\s*(\d+)\s*/\s*(\d+)\s*/\s*(\d+)\s*/\s*(\d+)\s*$")
+# End Define ##################################################################
+
+# Function:Log_Parse ##########################################################
+# Description : Parse the console output of a benchmark run. JSON lines carry
+#               their own board, compiler and configuration; text lines need
+#               the board from the command line and have no standard deviation.
+#               Tests of a cold cache or an interrupt storm run are kept apart
+#               with a name suffix.
+# Input       : lines - The console output lines.
+#               board - The board name for text output, or None.
+# Output      : None.
+# Return      : dict - The run: board, compiler, config and the test list.
+###############################################################################
+def Log_Parse(lines, board):
+    run={"board":board,"compiler":None,"config":None,"tests":[]}
+    last=None
+    suffix=""
+
+    for line in lines:
+        line=line.rstrip("\r\n")
+        start=line.find("{\"board\"")
+        if start>=0:
+            try:
+                test=json.loads(line[start:])
+            except ValueError:
+                # A garbled line, most likely from a console glitch
+                continue
+            for key in ("board","compiler","config"):
+                if run[key] is None:
+                    run[key]=test[key]
+                elif (key!="board" or board is None) and run[key]!=test[key]:
+                    raise ValueError("log mixes %s %s and %s"%(key,run[key],test[key]))
+                del test[key]
+            if test.pop("cache","warm")=="cold":
+                test["test"]+=COLD_SUFFIX
+            if test.pop("load","idle")=="storm":
+                test["test"]+=STORM_SUFFIX
+            run["tests"].append(test)
+            continue
+
+        if line.startswith(COLD_HEADER):
+            suffix=COLD_SUFFIX
+            continue
+        if line.startswith(STORM_HEADER):
+            suffix=STORM_SUFFIX
+            continue
+
+        match=TEXT_PCT.match(line)
+        if match and last is not None:
+            for key,value in zip(("p50","p90","p99","p999"),match.groups()):
+                last[key]=int(value)
+            continue
+
+        match=TEXT_LINE.match(line)
+        if match and not match.group(1).startswith("Test "):
+            last={"test":match.group(1)+suffix,"avg":int(match.group(2)),
+                  "max":int(match.group(3)),"min":int(match.group(4))}
+            run["tests"].append(last)
+
+    if not run["tests"]:
+        raise ValueError("no benchmark results found")
+    if board is not None:
+        run["board"]=board
+    if run["board"] is None:
+        raise ValueError("text output carries no board name, use --board")
+    if run["config"] is None:
+        run["config"]="text"
+    return run
+# End Function:Log_Parse ######################################################
+
+# Function:Run_Load ###########################################################
+# Description : Load a stored run. A bare board name means its baseline.
+# Input       : path - The run file or board name.
+#               store - The result store directory.
+# Output      : None.
+# Return      : dict - The run.
+###############################################################################
+def Run_Load(path, store):
+    if not os.path.exists(path):
+        path=os.path.join(store,path,BASELINE)
+    with open(path) as file:
+        return json.load(file)
+# End Function:Run_Load #######################################################
+
+# Function:Run_Save ###########################################################
+# Description : Write a run to a file as indented JSON.
+# Input       : run - The run.
+#               path - The file.
+# Output      : None.
+# Return      : None.
+###############################################################################
+def Run_Save(run, path):
+    os.makedirs(os.path.dirname(path),exist_ok=True)
+    with open(path,"w") as file:
+        json.dump(run,file,indent=1)
+        file.write("\n")
+# End Function:Run_Save #######################################################
+
+# Function:Cmd_Record #########################################################
+# Description : Parse a log and store it as a new run of its board.
+# Input       : args - The command line.
+# Output      : None.
+# Return      : int - The exit code.
+###############################################################################
+def Cmd_Record(args):
+    if args.log=="-":
+        lines=sys.stdin.readlines()
+    else:
+        with open(args.log,errors="replace") as file:
+            lines=file.readlines()
+
+    run=Log_Parse(lines,args.board)
+    run["time"]=time.strftime("%Y-%m-%d %H:%M:%S")
+    run["label"]=args.label
+    name=time.strftime("%Y%m%d-%H%M%S")+"-"+run["config"]
+    path=os.path.join(args.store,run["board"],name+".json")
+    # Never overwrite a run recorded within the same second
+    count=1
+    while os.path.exists(path):
+        path=os.path.join(args.store,run["board"],"%s-%d.json"%(name,count))
+        count+=1
+    Run_Save(run,path)
+    print(path)
+
+    # The first run of a board becomes its baseline
+    base=os.path.join(args.store,run["board"],BASELINE)
+    if not os.path.exists(base):
+        Run_Save(run,base)
+        print("baseline of %s set"%run["board"])
+    return 0
+# End Function:Cmd_Record #####################################################
+
+# Function:Cmd_Baseline #######################################################
+# Description : Make a stored run the baseline of its board.
+# Input       : args - The command line.
+# Output      : None.
+# Return      : int - The exit code.
+###############################################################################
+def Cmd_Baseline(args):
+    run=Run_Load(args.run,args.store)
+    Run_Save(run,os.path.join(args.store,run["board"],BASELINE))
+    print("baseline of %s set"%run["board"])
+    return 0
+# End Function:Cmd_Baseline ###################################################
+
+# Function:Welch_Z ############################################################
+# Description : Welch's test statistic for the difference of two means. With
+#               thousands of rounds the t distribution is the normal one, so
+#               this is used as a z score directly.
+# Input       : old, new - The two tests, with avg, stddev and rounds.
+# Output      : None.
+# Return      : float - The z score, or None when there is no deviation data.
+###############################################################################
+def Welch_Z(old, new):
+    if "stddev" not in old or "stddev" not in new:
+        return None
+    error=old["stddev"]**2/old["rounds"]+new["stddev"]**2/new["rounds"]
+    delta=new["avg"]-old["avg"]
+    if error==0:
+        return math.inf if delta>0 else (-math.inf if delta<0 else 0.0)
+    return delta/math.sqrt(error)
+# End Function:Welch_Z ########################################################
+
+# Function:Cmd_Compare ########################################################
+# Description : Compare a run against a baseline test by test. A test regresses
+#               when the chosen metric grows by more than the threshold and,
+#               where the deviation is known, the growth is significant.
+# Input       : args - The command line.
+# Output      : None.
+# Return      : int - 1 if anything regressed, 0 otherwise.
+###############################################################################
+def Cmd_Compare(args):
+    new=Run_Load(args.run,args.store)
+    old=Run_Load(args.baseline if args.baseline else new["board"],args.store)
+    if old["board"]!=new["board"]:
+        print("warning: comparing %s against %s"%(new["board"],old["board"]))
+    if old["config"]!=new["config"]:
+        print("warning: configuration %s differs from baseline %s, numbers may not be comparable"%
+              (new["config"],old["config"]))
+
+    base={test["test"]:test for test in old["tests"]}
+    failed=0
+    print("%-28s %10s %10s %8s %8s"%("Test",args.metric.upper()+" old","new","delta","z"))
+    for test in new["tests"]:
+        prev=base.get(test["test"])
+        if prev is None or args.metric not in test or args.metric not in prev:
+            print("%-28s %10s %10s"%(test["test"],"-",test.get(args.metric,"-")))
+            continue
+
+        delta=(test[args.metric]-prev[args.metric])*100.0/max(prev[args.metric],1)
+        z=Welch_Z(prev,test) if args.metric=="avg" else None
+        verdict=""
+        if delta>args.threshold and (z is None or z>args.z):
+            verdict="REGRESSION"
+            failed=1
+        elif delta<-args.threshold and (z is None or z<-args.z):
+            verdict="improved"
+        print(("%-28s %10d %10d %+7.1f%% %8s  %s"%(test["test"],prev[args.metric],test[args.metric],
+               delta,"-" if z is None else "%.1f"%z,verdict)).rstrip())
+
+    return failed
+# End Function:Cmd_Compare ####################################################
+
+# Function:Cmd_Chart ##########################################################
+# Description : Draw the AVG/MAX/MIN bar chart of a run, as in Figures/.
+# Input       : args - The command line.
+# Output      : None.
+# Return      : int - The exit code.
+###############################################################################
+def Cmd_Chart(args):
+    try:
+        import matplotlib
+        matplotlib.use("Agg")
+        import matplotlib.pyplot as plot
+    except ImportError:
+        print("chart needs matplotlib: pip install matplotlib")
+        return 2
+
+    run=Run_Load(args.run,args.store)
+    names=[SHORT.get(test["test"],test["test"]) for test in run["tests"]]
+    place=range(len(names))
+    width=0.25
+    figure,axis=plot.subplots(figsize=(20,10),dpi=360)
+    for offset,key,color in ((-width,"avg","#F07878"),(0,"max","#46698F"),(width,"min","#4BC0A9")):
+        values=[test[key] for test in run["tests"]]
+        bars=axis.bar([x+offset for x in place],values,width,label=key.upper(),color=color)
+        axis.bar_label(bars,fontsize=11)
+    axis.set_xticks(list(place))
+    axis.set_xticklabels(names,fontsize=14)
+    axis.set_xlabel("Operations",fontsize=14)
+    axis.set_ylabel("Time(cycles)",fontsize=14)
+    axis.set_title("Execution Time of Different FreeRTOS Operations on "+run["board"],fontsize=18)
+    axis.legend(fontsize=14)
+    figure.tight_layout()
+
+    out=args.out if args.out else os.path.join(FIGURES,run["board"]+".png")
+    figure.savefig(out)
+    print(out)
+    return 0
+# End Function:Cmd_Chart ######################################################
+
+# Function:main ###############################################################
+# Description : The entry of the tool.
+# Input       : None.
+# Output      : None.
+# Return      : int - The exit code.
+###############################################################################
+def main():
+    parser=argparse.ArgumentParser(description="FreeRTOS benchmark result store")
+    parser.add_argument("--store",default=STORE,help="result store directory")
+    command=parser.add_subparsers(dest="command",required=True)
+
+    sub=command.add_parser("record",help="store the results of a console log")
+    sub.add_argument("log",help="log file, or - for stdin")
+    sub.add_argument("--board",help="board name, needed for text output")
+    sub.add_argument("--label",default="",help="free-form note kept with the run")
+    sub.set_defaults(func=Cmd_Record)
+
+    sub=command.add_parser("baseline",help="make a run the baseline of its board")
+    sub.add_argument("run",help="run file")
+    sub.set_defaults(func=Cmd_Baseline)
+
+    sub=command.add_parser("compare",help="compare a run against the baseline")
+    sub.add_argument("run",help="run file")
+    sub.add_argument("--baseline",help="run file to compare with, default the board baseline")
+    sub.add_argument("--metric",default="avg",choices=("avg","min","max","p50","p90","p99","p999"))
+    sub.add_argument("--threshold",type=float,default=THRESHOLD,help="regression threshold in percent")
+    sub.add_argument("--z",type=float,default=Z_SCORE,help="significance threshold for avg")
+    sub.set_defaults(func=Cmd_Compare)
+
+    sub=command.add_parser("chart",help="draw the bar chart of a run")
+    sub.add_argument("run",help="run file or board name")
+    sub.add_argument("--out",help="output PNG, default Figures/<board>.png")
+    sub.set_defaults(func=Cmd_Chart)
+
+    args=parser.parse_args()
+    try:
+        return args.func(args)
+    except (OSError,ValueError,KeyError) as error:
+        print("error: %s"%error)
+        return 2
+# End Function:main ###########################################################
+
+if __name__=="__main__":
+    sys.exit(main())
+
+# End Of File #################################################################
+
+# Copyright (C) Evo-Devo Instrum. All rights reserved #########################
@@ -0,0 +1,4824 @@
+/******************************************************************************
+Filename    : bench.c
+Author      : hrs 
+Date        : 12/06/2024
+Licence     : The Unlicense; see LICENSE for details.
+Description : The performance benchmark for FreeRTOS on RVM. This is the core
+              shared by all boards; everything board-specific is in the test.h
+              of each board, behind the interface listed in bench.h.
+******************************************************************************/
+
+/* Include *******************************************************************/
+#include "test.h"
+#include "FreeRTOS.h"
+#include "task.h"
+#include "semphr.h"
+#include "queue.h"
+#include "event_groups.h"
+#include "timers.h"
+#include "bench.h"
+/* End Include ***************************************************************/
+
+/* Define ********************************************************************/
+/* Number of rounds to test - default to 10000 */
+#ifndef ROUND_NUM
+#define ROUND_NUM               (10000U)
+#endif
+#define OVERFLOW_NUM            (10000U)
+/* Valid bits of the timestamp counter - narrower counters define their own */
+#ifndef TEST_CNT_MASK
+#define TEST_CNT_MASK           (0xFFFFFFFFU)
+#endif
+/* Rate of the timestamp counter - the CPU clock unless the board sets it */
+#ifndef TEST_CNT_HZ
+#define TEST_CNT_HZ             (configCPU_CLOCK_HZ)
+#endif
+/* Rounds used to measure the cost of the counter read itself */
+#define OVERHEAD_NUM            (100U)
+/* Compiler reported in the structured output */
+#ifndef TEST_COMPILER
+#if defined(__ARMCC_VERSION)
+#define TEST_COMPILER           "ARMCLANG " __VERSION__
+#elif defined(__GNUC__)
+#define TEST_COMPILER           "GCC " __VERSION__
+#else
+#define TEST_COMPILER           "Unknown"
+#endif
+#endif
+
+/* Histogram resolution - 2^HIST_SUB_BITS linear buckets per power of two, so
+ * every bucket is within 1/2^HIST_SUB_BITS of the value it holds */
+#ifndef HIST_SUB_BITS
+#define HIST_SUB_BITS           (4U)
+#endif
+/* Histogram range - samples of HIST_VAL_BITS bits or more go to the last bucket */
+#ifndef HIST_VAL_BITS
+#define HIST_VAL_BITS           (32U)
+#endif
+#define HIST_SUB_NUM            (1U<<HIST_SUB_BITS)
+#define HIST_BUCKET_NUM         ((HIST_VAL_BITS-HIST_SUB_BITS+1U)*HIST_SUB_NUM)
+/* The bucket counters are 16-bit to save RAM */
+#if(ROUND_NUM>65535U)
+#error ROUND_NUM must fit in the 16-bit histogram bucket counters.
+#endif
+
+/* Memory pool test size in words - the same on all boards so that the results
+ * compare, except that boards short of RAM skip it with TEST_MEM_POOL_NONE */
+#ifndef TEST_MEM_POOL_NONE
+#define TEST_MEM_POOL           (4096U)
+#endif
+/* The heap_N.c linked in - heap_1 cannot free, so it only runs the heap tests
+ * that do not, and heap_3 has no statistics */
+#ifndef BENCH_HEAP
+#define BENCH_HEAP              (4U)
+#endif
+
+/* Data initialization */
+#define TEST_INIT() \
+do \
+{ \
+    Total=0U; \
+    Max=0U; \
+    Min=((uint32_t)-1U); \
+    Sq_Total=0U; \
+    Hist_Clear(Hist); \
+} \
+while(0)
+
+/* Data extraction */
+#define TEST_DATA() \
+do \
+{ \
+    Diff=(End-Start)&TEST_CNT_MASK; \
+    Diff=(Diff)>(Overhead)?((Diff)-(Overhead)):0U; \
+    Total+=(Diff); \
+    Sq_Total+=((uint64_t)(Diff))*(Diff); \
+    Max=(Diff)>(Max)?(Diff):(Max); \
+    Min=(Diff)<(Min)?(Diff):(Min); \
+    Hist_Record(Hist,Diff); \
+} \
+while(0)
+
+/* Data printing - define TEST_OUTPUT_JSON to get one JSON line per test instead
+ * of the text table, for Tools/bench.py to pick up */
+#ifdef TEST_OUTPUT_JSON
+#define TEST_LIST(X)            Test_Json(X)
+#else
+#define TEST_LIST(X) \
+do \
+{ \
+    Print_Str(X); \
+    Print_Str(" : "); \
+    Print_Int(Total/ROUND_NUM); \
+    Print_Str(" / "); \
+    Print_Int(Max); \
+    Print_Str(" / "); \
+    Print_Int(Min); \
+    Print_Str("\r\n"); \
+    Hist_Print(Hist); \
+} \
+while(0)
+#endif
+
+/* The receiver always runs as soon as something is sent, so at most one item
+ * is ever pending; these only need to fit the smallest board */
+#define SEM_CNT_MAX             (64U)
+#define QUEUE_LENGTH            (64U)
+#define QUEUE_ITEM_SIZE         sizeof(uint32_t)
+
+/* Log-linear latency histogram */
+struct Hist_Struct
+{
+    /* Number of samples */
+    uint32_t Count;
+    /* Divisor applied to the values when printing */
+    uint32_t Div;
+    uint16_t Bucket[HIST_BUCKET_NUM];
+};
+
+/* Test modes */
+/* The receiver runs alone */
+#define BENCH_LOCAL             (0U)
+/* The sender and the receiver take turns at the same priority */
+#define BENCH_SAME              (1U)
+/* The receiver is above the sender, so every send switches to it */
+#define BENCH_HIGH              (2U)
+/* The periodic interrupt sends to the receiver */
+#define BENCH_ISR               (3U)
+
+/* Helper tasks that some tests add next to the sender and the receiver - they
+ * run above both, and boards short of RAM define fewer */
+#ifndef BENCH_HELPER_NUM
+#define BENCH_HELPER_NUM        (64U)
+#endif
+#define BENCH_HELPER_PRIO       (3U)
+
+/* Timers that the timer scaling tests keep active - boards short of RAM
+ * define fewer */
+#ifndef BENCH_TIMER_NUM
+#define BENCH_TIMER_NUM         (256U)
+#endif
+/* Period of the timers and delays that must not expire, longer than that of
+ * any timer in the active list or any delayed helper, so that starting or
+ * delaying one walks the whole list */
+#define TIMER_IDLE_PERIOD       (100000U)
+
+/* Queue sweep operations, in the upper half of Arg - the lower half is the
+ * item size in bytes, or the depth for QUEUE_FILL */
+#define QUEUE_BACK              (0U)
+#define QUEUE_FRONT             (1U)
+#define QUEUE_OVERWRITE         (2U)
+#define QUEUE_PEEK              (3U)
+#define QUEUE_FILL              (4U)
+#define QUEUE_OP_NUM            (5U)
+#define QUEUE_SIZE_MAX          (256U)
+/* Item size of the depth sweep */
+#define QUEUE_FILL_SIZE         (16U)
+/* Registry entry of a queue sweep test */
+#define BENCH_QUEUE(NAME,OP,SIZE,DIV) \
+    {NAME,BENCH_LOCAL,ROUND_NUM,DIV,((OP)<<16)|(SIZE), \
+     Queue_Setup,NULL,Queue_Recv,NULL,Queue_Teardown}
+
+/* Task count scaling - the lower half of Arg is the number of helpers, and
+ * this flag times the wake-up instead of the block in the semaphore test */
+#define SCALE_WAKE              (1U<<16)
+#define SCALE_NUM(ARG)          ((ARG)&0xFFFFU)
+
+/* ISR phase breakdown - the phase timed is in the lower half of Arg, and the
+ * flag keeps interrupts masked by critical sections in the background */
+#define PHASE_IRQ               (0U)
+#define PHASE_TOTAL             (1U)
+#define PHASE_API               (2U)
+#define PHASE_YIELD             (3U)
+#define PHASE_SWITCH            (4U)
+#define PHASE_RESUME            (5U)
+#define PHASE_MASKED            (1U<<16)
+/* Loop count of each critical section in the masked background */
+#define PHASE_MASK_SPIN         (100U)
+
+/* What the self-deletion tests time */
+#define LIFE_DELETE             (0U)
+#define LIFE_RECLAIM            (1U)
+#define LIFE_IDLE               (2U)
+
+/* FPU context tests - the kind in the upper half of Arg, and who uses the
+ * FPU in the lower half */
+#define FPU_YIELD               (0U)
+#define FPU_NOTIFY              (1U)
+#define FPU_INT                 (2U)
+#define FPU_KIND_NUM            (3U)
+#define FPU_KIND(ARG)           ((ARG)>>16)
+#define FPU_SEND                (1U<<0)
+#define FPU_RECV                (1U<<1)
+#define FPU_ISR                 (1U<<2)
+#define FPU_USE_ALL             (FPU_SEND|FPU_RECV|FPU_ISR)
+#define FPU_ARG(KIND,USE)       (((KIND)<<16)|(USE))
+
+/* Cold cache runs, for BENCH_COLD - the bytes read through to evict the
+ * caches on top of Cache_Flush, for targets that cannot flush them */
+#ifndef BENCH_EVICT_SIZE
+#define BENCH_EVICT_SIZE        (0U)
+#endif
+#define EVICT_LINE              (32U)
+
+/* Heap tests - the size distribution and the side timed are packed in Arg.
+ * A workload holds the heap near HEAP_FILL percent of what was free when it
+ * started, allocating below that and freeing a random live block above it,
+ * the long-lived blocks only now and then. There is a slot for every
+ * HEAP_SLOT_BYTES of heap, which is less than any block of the mixes takes
+ * with its header, so the fill and not the table bounds the blocks live. The
+ * large blocks of the bimodal mix scale with the heap */
+#define HEAP_CHURN              (0U)
+#define HEAP_BIMODAL            (1U)
+#define HEAP_LIFETIME           (2U)
+#define HEAP_MALLOC             (0U)
+#define HEAP_FREE               (1U)
+#define HEAP_AGE                (2U)
+#define HEAP_NONE               (3U)
+#define HEAP_FAIL               (4U)
+#define HEAP_FULL               (5U)
+#define HEAP_ARG(DIST,SIDE)     (((DIST)<<4)|(SIDE))
+#define HEAP_DIST(ARG)          ((ARG)>>4)
+#define HEAP_SIDE(ARG)          ((ARG)&0xFU)
+#ifndef HEAP_FILL
+#define HEAP_FILL               (75U)
+#endif
+#define HEAP_SLOT_BYTES         (32U)
+#define HEAP_SLOT_NUM           (configTOTAL_HEAP_SIZE/HEAP_SLOT_BYTES)
+/* One in HEAP_LONG_SHARE blocks of the lifetime mix is long-lived, and is
+ * freed once in HEAP_LONG_ODDS times it is picked; it is marked in its size */
+#define HEAP_LONG_SHARE         (4U)
+#define HEAP_LONG_ODDS          (64U)
+#define HEAP_LONG_FLAG          (0x8000U)
+#define HEAP_LARGE_MIN          (configTOTAL_HEAP_SIZE/128U)
+#define HEAP_LARGE_MAX          (configTOTAL_HEAP_SIZE/32U)
+/* Operations per sample of the aging tests, and the fragmentation checks */
+#define HEAP_AGE_BATCH          (100U)
+#define HEAP_AGE_CHECK          (4U)
+#define BENCH_HEAP_TEST(NAME,DIST,SIDE) \
+    {NAME,BENCH_LOCAL,ROUND_NUM,((SIDE)==HEAP_AGE)?HEAP_AGE_BATCH:1U,HEAP_ARG(DIST,SIDE), \
+     Heap_Setup,NULL,((SIDE)==HEAP_AGE)?Heap_Age_Recv:Heap_Recv,NULL,Heap_Teardown}
+#if(BENCH_HEAP==5U)
+/* heap_5 gets two regions with a gap, so that the region end is walked too */
+#define HEAP_REGION_GAP         (64U)
+#endif
+
+/* Interrupt storm runs, for BENCH_STORM - the rates of the source above the
+ * kernel, which only does some work, and of the source that calls the kernel,
+ * and the loops of work the first one does */
+#ifndef BENCH_STORM_HZ_RAW
+#define BENCH_STORM_HZ_RAW      (20000U)
+#endif
+#ifndef BENCH_STORM_HZ_API
+#define BENCH_STORM_HZ_API      (5000U)
+#endif
+#ifndef BENCH_STORM_WORK
+#define BENCH_STORM_WORK        (32U)
+#endif
+#define STORM_RAW               (0U)
+#define STORM_API               (1U)
+#define STORM_NUM               (2U)
+#if(defined(BENCH_STORM)&&!defined(TEST_STORM))
+#error BENCH_STORM needs the storm sources, which this board does not have.
+#endif
+
+/* Throughput tests - the object, the priorities and the task counts are
+ * packed in Arg */
+#define THRU_QUEUE              (0U)
+#define THRU_SEM                (1U)
+#define THRU_NOTIFY             (2U)
+#define THRU_EQUAL              (0U)
+#define THRU_PROD_HIGH          (1U)
+#define THRU_CONS_HIGH          (2U)
+#define THRU_ARG(OBJ,PRIO,PROD,CONS) (((OBJ)<<12)|((PRIO)<<8)|((PROD)<<4)|(CONS))
+#define THRU_OBJ(ARG)           (((ARG)>>12)&0xFU)
+#define THRU_PRIO(ARG)          (((ARG)>>8)&0xFU)
+#define THRU_PROD(ARG)          (((ARG)>>4)&0xFU)
+#define THRU_CONS(ARG)          ((ARG)&0xFU)
+/* Messages per sample, all messages of a test, and the queue length */
+#define THRU_BATCH              (16U)
+#define THRU_TOTAL              (ROUND_NUM*THRU_BATCH)
+#define THRU_QUEUE_LEN          (4U)
+/* Most helpers of a throughput test, for the CPU share */
+#define THRU_TASK_MAX           (8U)
+#define BENCH_THRU(NAME,OBJ,PRIO,PROD,CONS) \
+    {NAME,BENCH_LOCAL,ROUND_NUM,THRU_BATCH,THRU_ARG(OBJ,PRIO,PROD,CONS), \
+     Thru_Setup,NULL,Thru_Recv,NULL,Thru_Teardown}
+
+/* Multi-wait tests - the mechanism and the number of sources are packed in
+ * Arg; from a task one source is posted per round, and from an interrupt all
+ * of them at once */
+#define MULTI_SET               (0U)
+#define MULTI_NOTIFY            (1U)
+#define MULTI_EVENT             (2U)
+#define MULTI_SEM               (3U)
+#define MULTI_ARG(OBJ,NUM)      (((OBJ)<<8)|(NUM))
+#define MULTI_OBJ(ARG)          ((ARG)>>8)
+#define MULTI_NUM(ARG)          ((ARG)&0xFFU)
+#define MULTI_ALL(ARG)          ((1U<<MULTI_NUM(ARG))-1U)
+#define MULTI_SRC_MAX           (8U)
+#define BENCH_MULTI(NAME,OBJ,NUM) \
+    {NAME,BENCH_HIGH,ROUND_NUM,1U,MULTI_ARG(OBJ,NUM), \
+     Multi_Setup,Multi_Send,Multi_Recv,NULL,Multi_Teardown}
+#define BENCH_MULTI_ISR(NAME,OBJ,NUM) \
+    {NAME,BENCH_ISR,ROUND_NUM,NUM,MULTI_ARG(OBJ,NUM), \
+     Multi_Setup,NULL,Multi_Recv,Multi_ISR,Multi_Teardown}
+
+/* Pipeline tests - the periodic interrupt feeds a filter task, which feeds an
+ * aggregator task, which passes batches to a logger task. Each link is a
+ * queue, or a ring with a notification if its bit is set in the lower half of
+ * Arg; the upper half is the stage whose latency is recorded */
+#define PIPE_LINK_FILTER        (0U)
+#define PIPE_LINK_AGG           (1U)
+#define PIPE_LINK_LOG           (2U)
+#define PIPE_LINK_NUM           (3U)
+#define PIPE_QUEUE              (0U)
+#define PIPE_NOTIFY             (7U)
+#define PIPE_MIXED              (1U<<PIPE_LINK_FILTER)
+/* The stages are the three links, and then from the interrupt to the log */
+#define PIPE_TOTAL              (3U)
+#define PIPE_ARG(LINKS,STAGE)   (((STAGE)<<16)|(LINKS))
+#define PIPE_STAGE(ARG)         ((ARG)>>16)
+#define PIPE_RING(ARG,LINK)     (((ARG)>>(LINK))&1U)
+/* Samples a link holds, samples per batch, batches the last link holds, and
+ * the length of the filter */
+#ifndef PIPE_DEPTH
+#define PIPE_DEPTH              (8U)
+#endif
+#define PIPE_BATCH              (4U)
+#define PIPE_BATCH_DEPTH        (4U)
+#define PIPE_TAPS               (8U)
+#define BENCH_PIPE(NAME,LINKS,STAGE) \
+    {NAME,BENCH_ISR,ROUND_NUM,1U,PIPE_ARG(LINKS,STAGE), \
+     Pipe_Setup,NULL,Pipe_Recv,Pipe_ISR,Pipe_Teardown}
+
+/* Periodic task tests - the periodic interrupt stands in for the tick, and
+ * PERIOD_TASK_NUM tasks are released by vTaskDelayUntil every few ticks, the
+ * shortest period on top. Arg is the set of periods, and the rounds are the
+ * ticks it takes the longest to be released ROUND_NUM times */
+#define PERIOD_HARMONIC         (0U)
+#define PERIOD_COPRIME          (1U)
+#define PERIOD_SET_NUM          (2U)
+#define PERIOD_TASK_NUM         (3U)
+#define PERIOD_RELEASE          (0U)
+#define PERIOD_RESPONSE         (1U)
+#define PERIOD_KIND_NUM         (2U)
+/* Loops of work each release does, and the tick timestamps kept */
+#define PERIOD_WORK             (32U)
+#define PERIOD_STAMP_NUM        (16U)
+#define BENCH_PERIOD(NAME,SET,LONGEST) \
+    {NAME,BENCH_ISR,(ROUND_NUM+2U)*(LONGEST),1U,SET, \
+     Period_Setup,NULL,Period_Recv,Period_ISR,Period_Teardown}
+
+/* Allocation trace records kept, for BENCH_TRACE - the latest ones stay */
+#ifndef BENCH_TRACE_NUM
+#define BENCH_TRACE_NUM         (1024U)
+#endif
+/* Tasks told apart in the trace; the last number stands for all the rest */
+#define TRACE_TASK_NUM          (127U)
+#define TRACE_FREE              (1U<<31)
+#define TRACE_INFO(SIZE,TASK)   (((SIZE)>0xFFFFFFU?0xFFFFFFU:(SIZE))|((TASK)<<24))
+/* The block header the sizes in traceMALLOC include, for the replay */
+#if((BENCH_HEAP==2U)||(BENCH_HEAP==4U)||(BENCH_HEAP==5U))
+#define TRACE_HEADER            ((sizeof(void*)*2U+portBYTE_ALIGNMENT-1U)&~((size_t)portBYTE_ALIGNMENT-1U))
+#else
+#define TRACE_HEADER            (0U)
+#endif
+
+/* Critical section profiler call sites, for BENCH_CRIT */
+#ifndef CRIT_SITE_NUM
+#define CRIT_SITE_NUM           (64U)
+#endif
+
+/* The event tests alternate between two bits, so that a waiter that is done
+ * with this round never sees the bit of the next one */
+#define EVENT_BIT(ROUND)        (1U<<((ROUND)&1U))
+
+/* Tests to run, as a list of entry numbers like "0,2-4" - default to all */
+#ifndef BENCH_SELECT
+#define BENCH_SELECT            ""
+#endif
+
+/* Benchmark descriptor */
+struct Bench_Struct
+{
+    /* Name, padded to line up the text table */
+    const char* Name;
+    /* One of the BENCH_* modes */
+    uint32_t Mode;
+    uint32_t Rounds;
+    /* Operations per sample - the results are divided by this */
+    uint32_t Div;
+    /* Parameter for entries that share hooks, such as a nesting depth */
+    uint32_t Arg;
+    /* Called by the receiver before the rounds and after the result is
+     * printed, may be NULL */
+    void (*Setup)(void);
+    /* One round on each side - the sender may be NULL */
+    void (*Sender)(uint32_t Round);
+    void (*Receiver)(uint32_t Round);
+    /* One round in the periodic interrupt, for BENCH_ISR */
+    void (*ISR)(void);
+    void (*Teardown)(void);
+};
+
+#ifdef BENCH_CRIT
+/* Longest masked window of a critical section call site */
+struct Crit_Site_Struct
+{
+    const char* File;
+    uint32_t Line;
+    uint32_t Max;
+    uint32_t Count;
+};
+#endif
+
+/* Results of one periodic task, kept apart from the other tasks' */
+struct Period_Stat_Struct
+{
+    uint64_t Total;
+    uint64_t Sq_Total;
+    uint32_t Max;
+    uint32_t Min;
+    struct Hist_Struct Hist;
+};
+
+/* One pipeline sample, with the time it was put on each link */
+struct Pipe_Sample_Struct
+{
+    uint32_t Seq;
+    uint32_t Value;
+    uint32_t Stamp[PIPE_LINK_NUM];
+};
+
+/* What the aggregator passes to the logger */
+struct Pipe_Batch_Struct
+{
+    uint32_t Num;
+    struct Pipe_Sample_Struct Sample[PIPE_BATCH];
+};
+
+#ifdef BENCH_TRACE
+/* One allocation trace record - the size in the low 24 bits of the info,
+ * then the task, then whether it is a free */
+struct Trace_Struct
+{
+    uint32_t Tick;
+    uint32_t Site;
+    uint32_t Addr;
+    uint32_t Info;
+};
+#endif
+/* End Define ****************************************************************/
+
+/* Global ********************************************************************/
+volatile uint32_t Flip=0U;
+volatile uint32_t Start=0U;
+volatile uint32_t End=0U;
+volatile uint32_t Diff=0U;
+volatile uint32_t Min=0U;
+volatile uint32_t Max=0U;
+volatile uint32_t Overhead=0U;
+volatile uint32_t Overflow=0U;
+volatile uint64_t Total=0U;
+volatile uint64_t Sq_Total=0U;
+
+/* Every test is printed as soon as it is done, so one histogram will do */
+struct Hist_Struct Hist_Data;
+struct Hist_Struct* Hist=&Hist_Data;
+
+/* The test being run, and the rounds its interrupt side has done */
+const struct Bench_Struct* volatile Bench_Cur=NULL;
+volatile uint32_t Int_Count=0U;
+/* Whether the caches are flushed before every round */
+volatile uint32_t Bench_Cold=0U;
+#if(defined(BENCH_COLD)&&(BENCH_EVICT_SIZE>0U))
+volatile uint8_t Evict_Buf[BENCH_EVICT_SIZE];
+volatile uint32_t Evict_Sum=0U;
+#endif
+/* Whether the interrupt storm is running, and what it has done */
+volatile uint32_t Bench_Storm=0U;
+#ifdef BENCH_STORM
+volatile uint32_t Storm_Count[STORM_NUM];
+volatile uint32_t Storm_Sum=0U;
+QueueHandle_t Queue_Storm;
+#endif
+#if(BENCH_HEAP==5U)
+uint8_t Heap_Mem[configTOTAL_HEAP_SIZE+HEAP_REGION_GAP];
+const HeapRegion_t Heap_Region[]=
+{
+    {Heap_Mem,configTOTAL_HEAP_SIZE/2U},
+    {Heap_Mem+configTOTAL_HEAP_SIZE/2U+HEAP_REGION_GAP,configTOTAL_HEAP_SIZE/2U},
+    {NULL,0U}
+};
+#endif
+
+TaskHandle_t Thd_1;
+TaskHandle_t Thd_2;
+
+QueueHandle_t Queue_1;
+uint32_t Val_Snt=1U;
+SemaphoreHandle_t Sem_1;
+SemaphoreHandle_t Mutex_1;
+SemaphoreHandle_t Mutex_Rec;
+EventGroupHandle_t Event_1;
+EventGroupHandle_t Event_Sync;
+TimerHandle_t Timer_1;
+TimerHandle_t Timer_Once;
+TimerHandle_t Timer_Auto;
+/* Timers kept active by the timer scaling tests */
+TimerHandle_t Timer_Pool[BENCH_TIMER_NUM];
+/* Queue of the sweep tests, its buffers, and the cost of the smallest item of
+ * each operation, for the cycles per byte */
+QueueHandle_t Queue_Sweep;
+uint8_t Queue_Snt[QUEUE_SIZE_MAX];
+uint8_t Queue_Rcv[QUEUE_SIZE_MAX];
+uint32_t Queue_Base[QUEUE_OP_NUM];
+/* ISR phase timestamps */
+volatile uint32_t Phase_Irq=0U;
+volatile uint32_t Phase_Entry=0U;
+volatile uint32_t Phase_Api_Start=0U;
+volatile uint32_t Phase_Api_End=0U;
+volatile uint32_t Phase_Switch=0U;
+volatile uint32_t Phase_Spin=0U;
+/* Semaphore that the helpers of the scaling tests block on */
+SemaphoreHandle_t Sem_Scale;
+/* Semaphore that the scheduler lock tests pend their helpers on */
+SemaphoreHandle_t Sem_Pend;
+/* Task lifecycle tests - the statically allocated task, whether the idle
+ * hook is to resume the receiver, and the creation cost of the smallest stack */
+StaticTask_t Life_Tcb;
+StackType_t Life_Stack[configMINIMAL_STACK_SIZE];
+volatile uint32_t Life_Idle_Wait=0U;
+uint32_t Life_Base=0U;
+/* Value the FPU context tests work on, and their integer results */
+volatile float Fpu_Val=1.0F;
+uint32_t Fpu_Base[FPU_KIND_NUM];
+/* Throughput tests - the objects, the messages taken so far, and the CPU
+ * time of every helper and of the rest */
+QueueHandle_t Queue_Thru;
+SemaphoreHandle_t Sem_Thru;
+volatile uint32_t Thru_Done=0U;
+#ifdef BENCH_PHASE
+volatile uint32_t Thru_Trace=0U;
+uint32_t Thru_Last=0U;
+uint32_t Thru_Slot=0U;
+uint64_t Thru_Busy[THRU_TASK_MAX+1U];
+#endif
+/* Multi-wait tests - the sources, the flags that go with the binary
+ * semaphore, and the heap that the objects took */
+SemaphoreHandle_t Multi_Src[MULTI_SRC_MAX];
+#if(configUSE_QUEUE_SETS==1)
+QueueSetHandle_t Multi_Set;
+#endif
+EventGroupHandle_t Multi_Event;
+SemaphoreHandle_t Multi_Bin;
+volatile uint32_t Multi_Flag=0U;
+uint32_t Multi_Ram=0U;
+/* Pipeline tests - the queues, the rings and their ends, the batches being
+ * built and logged, the filter state, and the samples logged so far */
+QueueHandle_t Queue_Pipe[PIPE_LINK_NUM];
+struct Pipe_Sample_Struct Pipe_Ring[PIPE_LINK_LOG][PIPE_DEPTH];
+struct Pipe_Batch_Struct Pipe_Batch_Ring[PIPE_BATCH_DEPTH];
+volatile uint32_t Pipe_Head[PIPE_LINK_NUM];
+volatile uint32_t Pipe_Tail[PIPE_LINK_NUM];
+struct Pipe_Batch_Struct Pipe_Agg;
+struct Pipe_Batch_Struct Pipe_Log;
+uint32_t Pipe_Tap[PIPE_TAPS];
+uint32_t Pipe_Sum=0U;
+volatile uint32_t Pipe_Done=0U;
+/* Periodic task tests - the periods of each set in ticks, the result names,
+ * the results, when each tick was due, the overruns, and the tasks done */
+const uint32_t Period_Set[PERIOD_SET_NUM][PERIOD_TASK_NUM]=
+{
+    {1U,2U,4U},
+    {2U,3U,5U}
+};
+const char* const Period_Name[PERIOD_SET_NUM][PERIOD_TASK_NUM][PERIOD_KIND_NUM]=
+{
+    {
+        {"Periodic harmonic 1T, release     ","Periodic harmonic 1T, response    "},
+        {"Periodic harmonic 2T, release     ","Periodic harmonic 2T, response    "},
+        {"Periodic harmonic 4T, release     ","Periodic harmonic 4T, response    "}
+    },
+    {
+        {"Periodic non-harmonic 2T, release ","Periodic non-harmonic 2T, response"},
+        {"Periodic non-harmonic 3T, release ","Periodic non-harmonic 3T, response"},
+        {"Periodic non-harmonic 5T, release ","Periodic non-harmonic 5T, response"}
+    }
+};
+struct Period_Stat_Struct Period_Stat[PERIOD_TASK_NUM][PERIOD_KIND_NUM];
+volatile uint32_t Period_Stamp[PERIOD_STAMP_NUM];
+uint32_t Period_Overrun[PERIOD_TASK_NUM];
+volatile uint32_t Period_Done=0U;
+/* Memory of the idle task and the timer daemon, as static allocation is on */
+StaticTask_t Idle_Tcb;
+StackType_t Idle_Stack[configMINIMAL_STACK_SIZE];
+StaticTask_t Timer_Tcb;
+StackType_t Timer_Stack[configTIMER_TASK_STACK_DEPTH];
+/* Helper tasks of the current test, and their progress */
+TaskHandle_t Thd_Helper[BENCH_HELPER_NUM];
+volatile uint32_t Helper_Num=0U;
+volatile uint32_t Helper_Done=0U;
+/* Sender task start and finish handshake */
+SemaphoreHandle_t Sem_Go;
+SemaphoreHandle_t Sem_Done;
+#ifdef BENCH_CRIT
+/* The outermost critical section, and the windows seen so far */
+uint32_t Crit_Nest=0U;
+uint32_t Crit_Start=0U;
+const char* Crit_File=NULL;
+uint32_t Crit_Line=0U;
+struct Crit_Site_Struct Crit_Site[CRIT_SITE_NUM];
+uint32_t Crit_Site_Num=0U;
+uint32_t Crit_Lost=0U;
+#endif
+#ifdef BENCH_TRACE
+/* The allocation trace ring, all records ever made, and the tasks seen */
+struct Trace_Struct Trace_Buf[BENCH_TRACE_NUM];
+uint32_t Trace_Total=0U;
+TaskHandle_t Trace_Task[TRACE_TASK_NUM];
+uint32_t Trace_Task_Num=0U;
+#endif
+/* End Global ****************************************************************/
+
+/* Function:Hist_Clear ********************************************************
+Description : Empty a latency histogram.
+Input       : struct Hist_Struct* Hist - The histogram.
+Output      : None.
+Return      : None.
+******************************************************************************/
+void Hist_Clear(struct Hist_Struct* Hist)
+{
+    uint32_t Count;
+    
+    Hist->Count=0U;
+    Hist->Div=1U;
+    for(Count=0U;Count<HIST_BUCKET_NUM;Count++)
+        Hist->Bucket[Count]=0U;
+}
+/* End Function:Hist_Clear ***************************************************/
+
+/* Function:Hist_Record *******************************************************
+Description : Record a sample into a latency histogram. Values below
+              2^(HIST_SUB_BITS+1) get a bucket each; above that, every power
+              of two is split into HIST_SUB_NUM equal buckets. This takes
+              constant time and touches no shared state, so it may be called
+              from an interrupt as long as each histogram has a single writer.
+Input       : struct Hist_Struct* Hist - The histogram.
+              uint32_t Val - The sample.
+Output      : None.
+Return      : None.
+******************************************************************************/
+static inline void Hist_Record(struct Hist_Struct* Hist, uint32_t Val)
+{
+    uint32_t Shift;
+    uint32_t Index;
+    
+    if(Val<(HIST_SUB_NUM<<1))
+        Index=Val;
+    else
+    {
+        Shift=31U-(uint32_t)__builtin_clz(Val)-HIST_SUB_BITS;
+        Index=((Shift+1U)<<HIST_SUB_BITS)+(Val>>Shift)-HIST_SUB_NUM;
+        if(Index>=HIST_BUCKET_NUM)
+            Index=HIST_BUCKET_NUM-1U;
+    }
+    
+    Hist->Count++;
+    Hist->Bucket[Index]++;
+}
+/* End Function:Hist_Record **************************************************/
+
+/* Function:Hist_Low **********************************************************
+Description : Get the lowest value that falls into a histogram bucket.
+Input       : uint32_t Index - The bucket index.
+Output      : None.
+Return      : uint32_t - The lowest value of the bucket.
+******************************************************************************/
+uint32_t Hist_Low(uint32_t Index)
+{
+    uint32_t Shift;
+    
+    if(Index<(HIST_SUB_NUM<<1))
+        return Index;
+    
+    Shift=(Index>>HIST_SUB_BITS)-1U;
+    return ((Index&(HIST_SUB_NUM-1U))+HIST_SUB_NUM)<<Shift;
+}
+/* End Function:Hist_Low *****************************************************/
+
+/* Function:Hist_High *********************************************************
+Description : Get the highest value that falls into a histogram bucket.
+Input       : uint32_t Index - The bucket index.
+Output      : None.
+Return      : uint32_t - The highest value of the bucket.
+******************************************************************************/
+uint32_t Hist_High(uint32_t Index)
+{
+    /* The last bucket also takes everything above the histogram range */
+    if(Index==(HIST_BUCKET_NUM-1U))
+        return (uint32_t)-1;
+    
+    return Hist_Low(Index+1U)-1U;
+}
+/* End Function:Hist_High ****************************************************/
+
+/* Function:Hist_Percentile ***************************************************
+Description : Find the value below which a given share of the samples fall.
+              The upper end of the bucket is returned, so the result never
+              understates the latency, and it is clipped to the real maximum.
+Input       : struct Hist_Struct* Hist - The histogram.
+              uint32_t Permille - The percentile, in units of 0.1%.
+Output      : None.
+Return      : uint32_t - The percentile value.
+******************************************************************************/
+uint32_t Hist_Percentile(struct Hist_Struct* Hist, uint32_t Permille)
+{
+    uint32_t Index;
+    uint32_t Rank;
+    uint32_t Sum;
+    uint32_t High;
+    
+    /* Rank of the sample, rounded up and counted from 1 - this cannot overflow
+     * as there are at most 65535 samples */
+    Rank=(Hist->Count*Permille+999U)/1000U;
+    if(Rank==0U)
+        Rank=1U;
+    
+    Sum=0U;
+    for(Index=0U;Index<HIST_BUCKET_NUM;Index++)
+    {
+        Sum+=Hist->Bucket[Index];
+        if(Sum>=Rank)
+            break;
+    }
+    
+    if(Index==HIST_BUCKET_NUM)
+        Index--;
+    
+    High=Hist_High(Index)/Hist->Div;
+    return High<Max?High:Max;
+}
+/* End Function:Hist_Percentile **********************************************/
+
+/* Function:Hist_Print ********************************************************
+Description : Print the percentiles and the non-empty buckets of a histogram,
+              following the AVG/MAX/MIN line of the test.
+Input       : struct Hist_Struct* Hist - The histogram.
+Output      : None.
+Return      : None.
+******************************************************************************/
+void Hist_Print(struct Hist_Struct* Hist)
+{
+    uint32_t Index;
+    uint32_t High;
+    
+    if(Hist->Count==0U)
+        return;
+    
+    Print_Str("    P50 / P90 / P99 / P99.9 / MAX : ");
+    Print_Int(Hist_Percentile(Hist,500U));
+    Print_Str(" / ");
+    Print_Int(Hist_Percentile(Hist,900U));
+    Print_Str(" / ");
+    Print_Int(Hist_Percentile(Hist,990U));
+    Print_Str(" / ");
+    Print_Int(Hist_Percentile(Hist,999U));
+    Print_Str(" / ");
+    Print_Int(Max);
+    Print_Str("\r\n");
+    
+    Print_Str("    Buckets (LOW-HIGH:COUNT)      :");
+    for(Index=0U;Index<HIST_BUCKET_NUM;Index++)
+    {
+        if(Hist->Bucket[Index]==0U)
+            continue;
+        
+        Print_Str(" ");
+        Print_Int(Hist_Low(Index)/Hist->Div);
+        Print_Str("-");
+        /* No sample is above the maximum, so clip the bucket to it */
+        High=Hist_High(Index)/Hist->Div;
+        Print_Int(High<Max?High:Max);
+        Print_Str(":");
+        Print_Int(Hist->Bucket[Index]);
+    }
+    Print_Str("\r\n");
+}
+/* End Function:Hist_Print ***************************************************/
+
+/* Function:Test_Overhead *****************************************************
+Description : Measure the cost of the counter read itself, so that it can be
+              subtracted from every sample. The two reads are made back to
+              back, like a test with nothing between Start and End, and the
+              smallest difference is taken.
+Input       : None.
+Output      : None.
+Return      : uint32_t - The read overhead, in counter ticks.
+******************************************************************************/
+uint32_t Test_Overhead(void)
+{
+    uint32_t Count;
+    uint32_t Cost;
+    uint32_t Least;
+    
+    Least=(uint32_t)-1;
+    for(Count=0U;Count<OVERHEAD_NUM;Count++)
+    {
+        Start=TEST_CNT_READ();
+        End=TEST_CNT_READ();
+        Cost=(End-Start)&TEST_CNT_MASK;
+        if(Cost<Least)
+            Least=Cost;
+    }
+    
+    return Least;
+}
+/* End Function:Test_Overhead ************************************************/
+
+/* Function:Config_Hash *******************************************************
+Description : Hash the build configuration that the numbers depend on, so that
+              results of different configurations are never compared with each
+              other. This is 32-bit FNV-1a over the configuration words.
+Input       : None.
+Output      : None.
+Return      : uint32_t - The configuration hash.
+******************************************************************************/
+uint32_t Config_Hash(void)
+{
+    uint32_t Config[13];
+    uint32_t Word;
+    uint32_t Byte;
+    uint32_t Hash;
+    
+    Config[0]=ROUND_NUM;
+    Config[1]=(uint32_t)configCPU_CLOCK_HZ;
+    Config[2]=(uint32_t)configTICK_RATE_HZ;
+    Config[3]=(uint32_t)configMAX_PRIORITIES;
+    Config[4]=(uint32_t)configTOTAL_HEAP_SIZE;
+    Config[5]=(uint32_t)configUSE_PORT_OPTIMISED_TASK_SELECTION;
+    Config[6]=SEM_CNT_MAX;
+    Config[7]=QUEUE_LENGTH;
+#ifdef TEST_MEM_POOL
+    Config[8]=TEST_MEM_POOL;
+#else
+    Config[8]=0U;
+#endif
+    Config[9]=(HIST_SUB_BITS<<8)|HIST_VAL_BITS;
+    Config[10]=TEST_CNT_MASK;
+#if defined(__OPTIMIZE_SIZE__)
+    Config[11]=2U;
+#elif defined(__OPTIMIZE__)
+    Config[11]=1U;
+#else
+    Config[11]=0U;
+#endif
+    /* Kernel build options - time slicing and the trace hooks */
+    Config[12]=(uint32_t)configUSE_TIME_SLICING;
+#ifdef BENCH_PHASE
+    Config[12]|=2U;
+#endif
+#ifdef BENCH_CRIT
+    Config[12]|=4U;
+#endif
+#ifdef BENCH_COLD
+    Config[12]|=8U;
+#endif
+#ifdef BENCH_STORM
+    Config[12]|=16U;
+#endif
+#ifdef BENCH_TRACE
+    Config[12]|=32U;
+#endif
+    /* The default heap_4 leaves the hash as it was */
+    Config[12]|=(BENCH_HEAP!=4U)?(BENCH_HEAP<<8):0U;
+    
+    Hash=2166136261U;
+    for(Word=0U;Word<13U;Word++)
+    {
+        for(Byte=0U;Byte<4U;Byte++)
+        {
+            Hash^=(Config[Word]>>(Byte*8U))&0xFFU;
+            Hash*=16777619U;
+        }
+    }
+    
+    return Hash;
+}
+/* End Function:Config_Hash **************************************************/
+
+/* Function:Sqrt_Get **********************************************************
+Description : Integer square root, rounded down. Bit by bit, so that no floating
+              point or division is involved.
+Input       : uint64_t Val - The value.
+Output      : None.
+Return      : uint32_t - The square root.
+******************************************************************************/
+uint32_t Sqrt_Get(uint64_t Val)
+{
+    uint64_t Root;
+    uint64_t Bit;
+    
+    Root=0U;
+    Bit=((uint64_t)1U)<<62;
+    while(Bit>Val)
+        Bit>>=2;
+    
+    while(Bit!=0U)
+    {
+        if(Val>=(Root+Bit))
+        {
+            Val-=Root+Bit;
+            Root=(Root>>1)+Bit;
+        }
+        else
+            Root>>=1;
+        Bit>>=2;
+    }
+    
+    return (uint32_t)Root;
+}
+/* End Function:Sqrt_Get *****************************************************/
+
+/* Function:Hex_Print *********************************************************
+Description : Print an unsigned integer on the debugging console as 8 hex digits.
+Input       : uint32_t Val - The integer to print.
+Output      : None.
+Return      : None.
+******************************************************************************/
+void Hex_Print(uint32_t Val)
+{
+    uint32_t Count;
+    uint32_t Digit;
+    
+    for(Count=0U;Count<8U;Count++)
+    {
+        Digit=(Val>>((7U-Count)*4U))&0x0FU;
+        if(Digit<10U)
+            PUTCHAR((signed char)Digit+'0');
+        else
+            PUTCHAR((signed char)(Digit-10U)+'A');
+    }
+}
+/* End Function:Hex_Print ****************************************************/
+
+/* Function:Test_Json *********************************************************
+Description : Print the statistics of a test as a single JSON line, following
+              the same data as the text table plus the standard deviation and
+              the histogram. The test name has its padding removed.
+Input       : const char* Name - The test name, as passed to TEST_LIST.
+Output      : None.
+Return      : None.
+******************************************************************************/
+void Test_Json(const char* Name)
+{
+    uint32_t Count;
+    uint32_t Length;
+    uint32_t High;
+    uint64_t Square;
+    
+    /* The names are padded with spaces to line up the text table */
+    Length=0U;
+    for(Count=0U;Name[Count]!='\0';Count++)
+    {
+        if(Name[Count]!=' ')
+            Length=Count+1U;
+    }
+    
+    Print_Str("{\"board\":\"" TEST_BOARD "\",\"compiler\":\"" TEST_COMPILER "\",\"config\":\"");
+    Hex_Print(Config_Hash());
+    Print_Str("\",\"test\":\"");
+    for(Count=0U;Count<Length;Count++)
+        PUTCHAR(Name[Count]);
+    Print_Str((Bench_Cold!=0U)?"\",\"cache\":\"cold":"\",\"cache\":\"warm");
+    Print_Str((Bench_Storm!=0U)?"\",\"load\":\"storm":"\",\"load\":\"idle");
+    Print_Str("\",\"rounds\":");
+    Print_Int(ROUND_NUM);
+    Print_Str(",\"overhead\":");
+    Print_Int(Overhead);
+    Print_Str(",\"avg\":");
+    Print_Int(Total/ROUND_NUM);
+    Print_Str(",\"max\":");
+    Print_Int(Max);
+    Print_Str(",\"min\":");
+    Print_Int(Min);
+    /* Variance is E[X^2]-E[X]^2, done on the sums to keep the precision */
+    Square=(Total*Total)/ROUND_NUM;
+    Print_Str(",\"stddev\":");
+    Print_Int(Sq_Total>Square?Sqrt_Get((Sq_Total-Square)/ROUND_NUM):0U);
+    Print_Str(",\"p50\":");
+    Print_Int(Hist_Percentile(Hist,500U));
+    Print_Str(",\"p90\":");
+    Print_Int(Hist_Percentile(Hist,900U));
+    Print_Str(",\"p99\":");
+    Print_Int(Hist_Percentile(Hist,990U));
+    Print_Str(",\"p999\":");
+    Print_Int(Hist_Percentile(Hist,999U));
+    
+    Print_Str(",\"hist\":[");
+    Length=0U;
+    for(Count=0U;Count<HIST_BUCKET_NUM;Count++)
+    {
+        if(Hist->Bucket[Count]==0U)
+            continue;
+        
+        if(Length!=0U)
+            Print_Str(",");
+        Length++;
+        Print_Str("[");
+        Print_Int(Hist_Low(Count)/Hist->Div);
+        Print_Str(",");
+        /* No sample is above the maximum, so clip the bucket to it */
+        High=Hist_High(Count)/Hist->Div;
+        Print_Int(High<Max?High:Max);
+        Print_Str(",");
+        Print_Int(Hist->Bucket[Count]);
+        Print_Str("]");
+    }
+    Print_Str("]}\r\n");
+}
+/* End Function:Test_Json ****************************************************/
+
+/* Function:Bench_Yield *******************************************************
+Description : The yield test. Both sides run at the same priority and yield to
+              each other.
+Input       : uint32_t Round - The current round.
+Output      : None.
+Return      : None.
+******************************************************************************/
+void Yield_Send(uint32_t Round)
+{
+    /* Test flip result */
+    if(Flip!=0U)
+    {
+        Print_Str("Yield error in Thd1 @ round ");
+        Print_Int(Round);
+        Print_Str(".\r\n");
+    }
+    Flip=1U;
+    /* Read counter here */
+    Start=TEST_CNT_READ();
+    taskYIELD();
+}
+
+void Yield_Recv(uint32_t Round)
+{
+    taskYIELD();
+    /* Read counter here */
+    End=TEST_CNT_READ();
+    TEST_DATA();
+    /* Test flip result */
+    if(Flip==0U)
+    {
+        Print_Str("Yield error in Thd2 @ round ");
+        Print_Int(Round);
+        Print_Str(", ");
+        Print_Int(Start);
+        Print_Str(", ");
+        Print_Int(End);
+        Print_Str(".\r\n");
+    }
+    Flip=0U;
+}
+/* End Function:Bench_Yield **************************************************/
+
+/* Function:Bench_Notify ******************************************************
+Description : The task notification tests, from a task or from an interrupt.
+Input       : uint32_t Round - The current round.
+Output      : None.
+Return      : None.
+******************************************************************************/
+void Notify_Send(uint32_t Round)
+{
+    /* Read counter here */
+    Start=TEST_CNT_READ();
+    xTaskNotify(Thd_2,1U,eSetValueWithOverwrite);
+}
+
+void Notify_ISR(void)
+{
+    BaseType_t Task_Woke=pdFALSE;
+    
+    Start=TEST_CNT_READ();
+    xTaskNotifyFromISR(Thd_2,1U,eSetValueWithOverwrite,&Task_Woke);
+    portYIELD_FROM_ISR(Task_Woke);
+}
+
+void Notify_Recv(uint32_t Round)
+{
+    uint32_t Data;
+    
+    xTaskNotifyWait(0x00,0xFFFFFFFF,&Data,portMAX_DELAY);
+    /* Read counter here */
+    End=TEST_CNT_READ();
+    TEST_DATA();
+    Flip=0U;
+}
+/* End Function:Bench_Notify *************************************************/
+
+/* Function:Bench_Sem *********************************************************
+Description : The semaphore tests, from a task or from an interrupt.
+Input       : uint32_t Round - The current round.
+Output      : None.
+Return      : None.
+******************************************************************************/
+void Sem_Send(uint32_t Round)
+{
+    /* Read counter here */
+    Start=TEST_CNT_READ();
+    xSemaphoreGive(Sem_1);
+}
+
+void Sem_ISR(void)
+{
+    BaseType_t Retval;
+    BaseType_t Task_Woke=pdFALSE;
+    
+    Start=TEST_CNT_READ();
+    Retval=xSemaphoreGiveFromISR(Sem_1,&Task_Woke);
+    portYIELD_FROM_ISR(Task_Woke);
+    if(Retval!=pdTRUE)
+        Print_Str("ISR semaphore post failed.\r\n");
+}
+
+void Sem_Recv(uint32_t Round)
+{
+    xSemaphoreTake(Sem_1,portMAX_DELAY);
+    /* Read counter here */
+    End=TEST_CNT_READ();
+    TEST_DATA();
+    Flip=0U;
+}
+/* End Function:Bench_Sem ****************************************************/
+
+/* Function:Bench_Bmq *********************************************************
+Description : The blocking message queue tests, from a task or from an
+              interrupt.
+Input       : uint32_t Round - The current round.
+Output      : None.
+Return      : None.
+******************************************************************************/
+void Bmq_Send(uint32_t Round)
+{
+    /* Read counter here */
+    Start=TEST_CNT_READ();
+    xQueueSend(Queue_1,&Val_Snt,portMAX_DELAY);
+}
+
+void Bmq_ISR(void)
+{
+    BaseType_t Retval;
+    BaseType_t Task_Woke=pdFALSE;
+    uint32_t Val_Snt=1U;
+    
+    Start=TEST_CNT_READ();
+    Retval=xQueueSendFromISR(Queue_1,&Val_Snt,&Task_Woke);
+    portYIELD_FROM_ISR(Task_Woke);
+    if(Retval!=pdTRUE)
+        Print_Str("ISR bmq message send failed.\r\n");
+}
+
+void Bmq_Recv(uint32_t Round)
+{
+    uint32_t Data;
+    
+    xQueueReceive(Queue_1,&Data,portMAX_DELAY);
+    /* Read counter here */
+    End=TEST_CNT_READ();
+    TEST_DATA();
+    Flip=0U;
+}
+/* End Function:Bench_Bmq ****************************************************/
+
+/* Function:Bench_Mutex *******************************************************
+Description : The mutex tests. The uncontended test takes and gives the mutex in
+              one task. In the contended tests the sender holds the mutex when
+              the receiver, being above it, tries to take it; the receiver then
+              blocks and lends its priority to the sender. Arg selects the half
+              that is timed: 0 for the blocking take up to the sender running
+              with the inherited priority, 1 for the give that drops it and
+              hands the mutex over to the receiver.
+Input       : uint32_t Round - The current round.
+Output      : None.
+Return      : None.
+******************************************************************************/
+void Mutex_Recv(uint32_t Round)
+{
+    /* Read counter here */
+    Start=TEST_CNT_READ();
+    xSemaphoreTake(Mutex_1,portMAX_DELAY);
+    xSemaphoreGive(Mutex_1);
+    End=TEST_CNT_READ();
+    TEST_DATA();
+}
+
+void Mutex_Cont_Send(uint32_t Round)
+{
+    xSemaphoreTake(Mutex_1,portMAX_DELAY);
+    /* Wake the receiver, which comes back here by blocking on the mutex */
+    xTaskNotify(Thd_2,1U,eSetValueWithOverwrite);
+    if(Bench_Cur->Arg==0U)
+    {
+        End=TEST_CNT_READ();
+        TEST_DATA();
+    }
+    
+    /* Test inheritance result */
+    if(uxTaskPriorityGet(NULL)!=2U)
+    {
+        Print_Str("Mutex inheritance error @ round ");
+        Print_Int(Round);
+        Print_Str(".\r\n");
+    }
+    
+    if(Bench_Cur->Arg!=0U)
+        Start=TEST_CNT_READ();
+    xSemaphoreGive(Mutex_1);
+}
+
+void Mutex_Cont_Recv(uint32_t Round)
+{
+    uint32_t Data;
+    
+    xTaskNotifyWait(0x00,0xFFFFFFFF,&Data,portMAX_DELAY);
+    if(Bench_Cur->Arg==0U)
+        Start=TEST_CNT_READ();
+    xSemaphoreTake(Mutex_1,portMAX_DELAY);
+    if(Bench_Cur->Arg!=0U)
+    {
+        End=TEST_CNT_READ();
+        TEST_DATA();
+    }
+    xSemaphoreGive(Mutex_1);
+}
+/* End Function:Bench_Mutex **************************************************/
+
+/* Function:Bench_Mutex_Rec ***************************************************
+Description : The recursive mutex test. Each round takes the mutex Arg times
+              and then gives it back as many times, so it is counted as Arg
+              take/give pairs; the first take and the last give are the ones
+              that really change the owner.
+Input       : uint32_t Round - The current round.
+Output      : None.
+Return      : None.
+******************************************************************************/
+void Mutex_Rec_Recv(uint32_t Round)
+{
+    uint32_t Count;
+    uint32_t Depth;
+    
+    Depth=Bench_Cur->Arg;
+    /* Read counter here */
+    Start=TEST_CNT_READ();
+    for(Count=0U;Count<Depth;Count++)
+        xSemaphoreTakeRecursive(Mutex_Rec,portMAX_DELAY);
+    for(Count=0U;Count<Depth;Count++)
+        xSemaphoreGiveRecursive(Mutex_Rec);
+    End=TEST_CNT_READ();
+    TEST_DATA();
+}
+/* End Function:Bench_Mutex_Rec **********************************************/
+
+/* Function:Helper_Create ****************************************************
+Description : Create the helper tasks of a test. They are above the sender and
+              the receiver unless told otherwise, so each runs until it first
+              blocks before this returns.
+Input       : TaskFunction_t Func - The helper task body, which is passed the
+                                    helper number.
+              uint32_t Num - The number of helpers.
+              uint32_t Prio - The priority of the helpers.
+Output      : None.
+Return      : None.
+******************************************************************************/
+void Helper_Create(TaskFunction_t Func, uint32_t Num, uint32_t Prio)
+{
+    uint32_t Count;
+    
+    Helper_Num=Num;
+    Helper_Done=0U;
+    for(Count=0U;Count<Num;Count++)
+    {
+        if(xTaskCreate(Func,"Helper",configMINIMAL_STACK_SIZE,(void*)(size_t)Count,
+                       Prio,&Thd_Helper[Count])!=pdPASS)
+        {
+            Print_Str("Helper task creation failure: ");
+            Print_Int(Count);
+            Print_Str(".\r\n");
+            while(1);
+        }
+    }
+}
+/* End Function:Helper_Create ************************************************/
+
+/* Function:Helper_Delete ****************************************************
+Description : Delete the helper tasks of a test. They are not the caller, so
+              their memory is returned at once rather than by the idle task.
+Input       : None.
+Output      : None.
+Return      : None.
+******************************************************************************/
+void Helper_Delete(void)
+{
+    uint32_t Count;
+    
+    for(Count=0U;Count<Helper_Num;Count++)
+        vTaskDelete(Thd_Helper[Count]);
+    Helper_Num=0U;
+}
+/* End Function:Helper_Delete ************************************************/
+
+/* Function:Helper_Drain *****************************************************
+Description : Let the helper tasks below the receiver run until they have all
+              blocked. The receiver drops to their priority and yields until
+              none of them is ready; round robin does not always put it
+              behind all of them at once.
+Input       : None.
+Output      : None.
+Return      : None.
+******************************************************************************/
+void Helper_Drain(void)
+{
+    uint32_t Count;
+    
+    vTaskPrioritySet(NULL,1U);
+    for(Count=0U;Count<Helper_Num;Count++)
+    {
+        while(eTaskGetState(Thd_Helper[Count])==eReady)
+            taskYIELD();
+    }
+    vTaskPrioritySet(NULL,2U);
+}
+/* End Function:Helper_Drain *************************************************/
+
+/* Function:Bench_Event *******************************************************
+Description : The event group tests, from a task or from an interrupt. The
+              receiver and Arg-1 helpers wait for the same bit, so setting it
+              wakes Arg tasks; the helpers are above the receiver, so the
+              receiver runs last and its timestamp covers the whole wake-up.
+              From an interrupt, the bits are set by the timer daemon task
+              that the ISR defers to.
+Input       : uint32_t Round - The current round.
+Output      : None.
+Return      : None.
+******************************************************************************/
+void Event_Helper(void* Param)
+{
+    uint32_t Round;
+    
+    for(Round=0U;;Round++)
+    {
+        xEventGroupWaitBits(Event_1,EVENT_BIT(Round),pdFALSE,pdFALSE,portMAX_DELAY);
+        Helper_Done++;
+    }
+}
+
+void Event_Setup(void)
+{
+    xEventGroupClearBits(Event_1,EVENT_BIT(0U)|EVENT_BIT(1U));
+    Helper_Create(Event_Helper,Bench_Cur->Arg-1U,BENCH_HELPER_PRIO);
+}
+
+void Event_Send(uint32_t Round)
+{
+    /* Read counter here */
+    Start=TEST_CNT_READ();
+    xEventGroupSetBits(Event_1,EVENT_BIT(Round));
+}
+
+#if((configUSE_TIMERS==1)&&(INCLUDE_xTimerPendFunctionCall==1))
+void Event_ISR(void)
+{
+    BaseType_t Retval;
+    BaseType_t Task_Woke=pdFALSE;
+    
+    Start=TEST_CNT_READ();
+    /* The handler has already counted this round */
+    Retval=xEventGroupSetBitsFromISR(Event_1,EVENT_BIT(Int_Count-1U),&Task_Woke);
+    portYIELD_FROM_ISR(Task_Woke);
+    if(Retval!=pdPASS)
+        Print_Str("ISR event set failed.\r\n");
+}
+#endif
+
+void Event_Recv(uint32_t Round)
+{
+    /* The helpers have moved on to the other bit, so this may clear it */
+    xEventGroupWaitBits(Event_1,EVENT_BIT(Round),pdTRUE,pdFALSE,portMAX_DELAY);
+    /* Read counter here */
+    End=TEST_CNT_READ();
+    TEST_DATA();
+    /* Test wake-up result */
+    if(Helper_Done!=Helper_Num)
+    {
+        Print_Str("Event wake-up error @ round ");
+        Print_Int(Round);
+        Print_Str(".\r\n");
+    }
+    Helper_Done=0U;
+    Flip=0U;
+}
+/* End Function:Bench_Event **************************************************/
+
+/* Function:Bench_Event_Sync **************************************************
+Description : The event group barrier test. The receiver and Arg-1 helpers
+              meet at xEventGroupSync; the helpers arrive first, so the
+              receiver's call releases them all, and it returns once they are
+              all waiting at the next barrier.
+Input       : uint32_t Round - The current round.
+Output      : None.
+Return      : None.
+******************************************************************************/
+void Event_Sync_Helper(void* Param)
+{
+    EventBits_t Bit;
+    
+    /* Bit 0 is the receiver's */
+    Bit=((EventBits_t)1U)<<((size_t)Param+1U);
+    while(1)
+        xEventGroupSync(Event_Sync,Bit,(((EventBits_t)1U)<<Bench_Cur->Arg)-1U,portMAX_DELAY);
+}
+
+void Event_Sync_Setup(void)
+{
+    xEventGroupClearBits(Event_Sync,(((EventBits_t)1U)<<Bench_Cur->Arg)-1U);
+    Helper_Create(Event_Sync_Helper,Bench_Cur->Arg-1U,BENCH_HELPER_PRIO);
+}
+
+void Event_Sync_Recv(uint32_t Round)
+{
+    /* Read counter here */
+    Start=TEST_CNT_READ();
+    xEventGroupSync(Event_Sync,1U,(((EventBits_t)1U)<<Bench_Cur->Arg)-1U,portMAX_DELAY);
+    End=TEST_CNT_READ();
+    TEST_DATA();
+}
+/* End Function:Bench_Event_Sync *********************************************/
+
+/* Function:Bench_Timer *******************************************************
+Description : The software timer command tests. xTimerStart and xTimerReset
+              post a command to the timer daemon, which is above every test
+              task, so the call returns after the daemon has inserted the timer
+              into its active list. Arg timers are kept active beforehand, all
+              expiring before the one being started, to show how the insertion
+              grows with them.
+Input       : uint32_t Round - The current round.
+Output      : None.
+Return      : None.
+******************************************************************************/
+void Timer_Callback(TimerHandle_t Timer)
+{
+    /* Read counter here */
+    End=TEST_CNT_READ();
+    xTaskNotify(Thd_2,1U,eSetValueWithOverwrite);
+}
+
+void Timer_Setup(void)
+{
+    uint32_t Count;
+    
+    for(Count=0U;Count<Bench_Cur->Arg;Count++)
+    {
+        Timer_Pool[Count]=xTimerCreate("Pool",1000U+Count,pdFALSE,NULL,Timer_Callback);
+        if(Timer_Pool[Count]==NULL)
+        {
+            Print_Str("Timer creation failure: ");
+            Print_Int(Count);
+            Print_Str(".\r\n");
+            while(1);
+        }
+        xTimerStart(Timer_Pool[Count],portMAX_DELAY);
+    }
+}
+
+void Timer_Start_Recv(uint32_t Round)
+{
+    /* Read counter here */
+    Start=TEST_CNT_READ();
+    xTimerStart(Timer_1,portMAX_DELAY);
+    End=TEST_CNT_READ();
+    TEST_DATA();
+    xTimerStop(Timer_1,portMAX_DELAY);
+}
+
+void Timer_Reset_Setup(void)
+{
+    xTimerStart(Timer_1,portMAX_DELAY);
+}
+
+void Timer_Reset_Recv(uint32_t Round)
+{
+    /* Read counter here */
+    Start=TEST_CNT_READ();
+    xTimerReset(Timer_1,portMAX_DELAY);
+    End=TEST_CNT_READ();
+    TEST_DATA();
+}
+
+void Timer_Teardown(void)
+{
+    uint32_t Count;
+    
+    xTimerStop(Timer_1,portMAX_DELAY);
+    for(Count=0U;Count<Bench_Cur->Arg;Count++)
+        xTimerDelete(Timer_Pool[Count],portMAX_DELAY);
+}
+/* End Function:Bench_Timer **************************************************/
+
+/* Function:Bench_Timer_Expiry ************************************************
+Description : The software timer expiry tests. The tick is off during the
+              benchmark, so the periodic interrupt stands in for it, and every
+              interrupt is one tick; a timer of one tick expires on each. The
+              time is from the tick to the callback entry in the daemon. The
+              one-shot timer is restarted by the receiver every round; the
+              auto-reload timer is reloaded by the daemon before the callback,
+              and the spread of its samples is the jitter of the period.
+Input       : uint32_t Round - The current round.
+Output      : None.
+Return      : None.
+******************************************************************************/
+void Timer_Expiry_Setup(void)
+{
+    xTimerStart((Bench_Cur->Arg!=0U)?Timer_Auto:Timer_Once,portMAX_DELAY);
+}
+
+void Timer_Expiry_ISR(void)
+{
+    UBaseType_t Mask;
+    BaseType_t Task_Woke;
+    
+    Start=TEST_CNT_READ();
+    /* What the port's tick handler does */
+    Mask=portSET_INTERRUPT_MASK_FROM_ISR();
+    Task_Woke=xTaskIncrementTick();
+    portCLEAR_INTERRUPT_MASK_FROM_ISR(Mask);
+    portYIELD_FROM_ISR(Task_Woke);
+}
+
+void Timer_Expiry_Recv(uint32_t Round)
+{
+    uint32_t Data;
+    
+    xTaskNotifyWait(0x00,0xFFFFFFFF,&Data,portMAX_DELAY);
+    TEST_DATA();
+    /* The next tick is the next round */
+    if(Bench_Cur->Arg==0U)
+        xTimerStart(Timer_Once,portMAX_DELAY);
+    Flip=0U;
+}
+
+void Timer_Expiry_Teardown(void)
+{
+    xTimerStop((Bench_Cur->Arg!=0U)?Timer_Auto:Timer_Once,portMAX_DELAY);
+}
+/* End Function:Bench_Timer_Expiry *******************************************/
+
+/* Function:Bench_Queue_Sweep *************************************************
+Description : The queue payload and depth sweep. These run in one task, so that
+              only the copy into and out of the queue storage changes with the
+              item size. Each round is a send to the back, a send to the front
+              or an overwrite followed by a receive, or a peek alone; the depth
+              sweep sends Arg items of QUEUE_FILL_SIZE bytes and then receives
+              them all. After the largest item of an operation, the cycles per
+              byte are printed, taken from the averages of the smallest and the
+              largest item; a minimum is a single sample that noise can pull
+              either way. A slope below zero is printed as it is.
+Input       : uint32_t Round - The current round.
+Output      : None.
+Return      : None.
+******************************************************************************/
+void Queue_Setup(void)
+{
+    uint32_t Op;
+    uint32_t Size;
+    uint32_t Count;
+    
+    Op=Bench_Cur->Arg>>16;
+    Size=Bench_Cur->Arg&0xFFFFU;
+    for(Count=0U;Count<QUEUE_SIZE_MAX;Count++)
+        Queue_Snt[Count]=(uint8_t)Count;
+    
+    if(Op==QUEUE_FILL)
+        Queue_Sweep=xQueueCreate(Size,QUEUE_FILL_SIZE);
+    else
+        Queue_Sweep=xQueueCreate(1U,Size);
+    if(Queue_Sweep==NULL)
+    {
+        Print_Str("Queue creation failure.\r\n");
+        while(1);
+    }
+    
+    /* Peek leaves the item in the queue */
+    if(Op==QUEUE_PEEK)
+        xQueueSend(Queue_Sweep,Queue_Snt,0U);
+}
+
+void Queue_Recv(uint32_t Round)
+{
+    uint32_t Count;
+    uint32_t Depth;
+    BaseType_t Retval;
+    
+    Retval=pdPASS;
+    /* Read counter here */
+    switch(Bench_Cur->Arg>>16)
+    {
+        case QUEUE_BACK:
+        {
+            Start=TEST_CNT_READ();
+            xQueueSendToBack(Queue_Sweep,Queue_Snt,0U);
+            Retval=xQueueReceive(Queue_Sweep,Queue_Rcv,0U);
+            End=TEST_CNT_READ();
+            break;
+        }
+        case QUEUE_FRONT:
+        {
+            Start=TEST_CNT_READ();
+            xQueueSendToFront(Queue_Sweep,Queue_Snt,0U);
+            Retval=xQueueReceive(Queue_Sweep,Queue_Rcv,0U);
+            End=TEST_CNT_READ();
+            break;
+        }
+        case QUEUE_OVERWRITE:
+        {
+            Start=TEST_CNT_READ();
+            xQueueOverwrite(Queue_Sweep,Queue_Snt);
+            Retval=xQueueReceive(Queue_Sweep,Queue_Rcv,0U);
+            End=TEST_CNT_READ();
+            break;
+        }
+        case QUEUE_PEEK:
+        {
+            Start=TEST_CNT_READ();
+            Retval=xQueuePeek(Queue_Sweep,Queue_Rcv,0U);
+            End=TEST_CNT_READ();
+            break;
+        }
+        default:
+        {
+            Depth=Bench_Cur->Arg&0xFFFFU;
+            Start=TEST_CNT_READ();
+            for(Count=0U;Count<Depth;Count++)
+                xQueueSendToBack(Queue_Sweep,Queue_Snt,0U);
+            for(Count=0U;Count<Depth;Count++)
+                Retval&=xQueueReceive(Queue_Sweep,Queue_Rcv,0U);
+            End=TEST_CNT_READ();
+            break;
+        }
+    }
+    TEST_DATA();
+    
+    /* Test copy result */
+    if((Retval!=pdPASS)||(Queue_Rcv[1]!=1U))
+    {
+        Print_Str("Queue sweep error @ round ");
+        Print_Int(Round);
+        Print_Str(".\r\n");
+    }
+}
+
+void Queue_Teardown(void)
+{
+    uint32_t Op;
+    uint32_t Size;
+    uint32_t Avg;
+    uint32_t Slope;
+    
+    vQueueDelete(Queue_Sweep);
+    
+    Op=Bench_Cur->Arg>>16;
+    Size=Bench_Cur->Arg&0xFFFFU;
+    if(Op==QUEUE_FILL)
+        return;
+    
+    Avg=(uint32_t)(Total/Bench_Cur->Rounds);
+    if(Size<=4U)
+        Queue_Base[Op]=Avg;
+    else if(Size==QUEUE_SIZE_MAX)
+    {
+        /* In hundredths of a cycle, as there is no floating point printing;
+         * a negative one says the copy is lost in the noise */
+        Print_Str("    Cycles per byte               : ");
+        if(Avg<Queue_Base[Op])
+        {
+            Print_Str("-");
+            Slope=(Queue_Base[Op]-Avg)*100U/(QUEUE_SIZE_MAX-4U);
+        }
+        else
+            Slope=(Avg-Queue_Base[Op])*100U/(QUEUE_SIZE_MAX-4U);
+        Print_Int(Slope/100U);
+        Print_Str(".");
+        Print_Int((Slope%100U)/10U);
+        Print_Int(Slope%10U);
+        Print_Str("\r\n");
+    }
+}
+/* End Function:Bench_Queue_Sweep ********************************************/
+
+/* Function:Bench_Scale_Sem ***************************************************
+Description : The semaphore task count scaling test. Arg helpers, all above
+              the receiver, wait on one semaphore. Every round the receiver
+              gives it, which wakes the helper at the head of the list, and
+              that helper takes it again; being of the same priority as the
+              others, it walks past all of them to the tail. The block is
+              timed from that take to the receiver running again, and with
+              SCALE_WAKE the wake-up is timed from the give to the helper
+              running.
+Input       : uint32_t Round - The current round.
+Output      : None.
+Return      : None.
+******************************************************************************/
+void Scale_Sem_Helper(void* Param)
+{
+    while(1)
+    {
+        /* Read counter here */
+        if((Bench_Cur->Arg&SCALE_WAKE)==0U)
+            Start=TEST_CNT_READ();
+        xSemaphoreTake(Sem_Scale,portMAX_DELAY);
+        if((Bench_Cur->Arg&SCALE_WAKE)!=0U)
+        {
+            End=TEST_CNT_READ();
+            TEST_DATA();
+        }
+        Helper_Done++;
+    }
+}
+
+void Scale_Sem_Setup(void)
+{
+    Helper_Create(Scale_Sem_Helper,SCALE_NUM(Bench_Cur->Arg),BENCH_HELPER_PRIO);
+}
+
+void Scale_Sem_Recv(uint32_t Round)
+{
+    if((Bench_Cur->Arg&SCALE_WAKE)!=0U)
+        Start=TEST_CNT_READ();
+    xSemaphoreGive(Sem_Scale);
+    if((Bench_Cur->Arg&SCALE_WAKE)==0U)
+    {
+        End=TEST_CNT_READ();
+        TEST_DATA();
+    }
+
+    /* Test wake-up result */
+    if(Helper_Done!=1U)
+    {
+        Print_Str("Semaphore scaling error @ round ");
+        Print_Int(Round);
+        Print_Str(".\r\n");
+    }
+    Helper_Done=0U;
+}
+/* End Function:Bench_Scale_Sem **********************************************/
+
+/* Function:Bench_Scale_Delay *************************************************
+Description : The delayed list task count scaling test. Arg helpers are
+              delayed with staggered timeouts that never expire, as the tick
+              is off, or in the tick tests is only driven for ROUND_NUM ticks.
+              Every round the receiver delays for longer than all of
+              them, so it is inserted at the tail; the sender then times the
+              block and aborts the delay for the next round.
+Input       : uint32_t Round - The current round.
+Output      : None.
+Return      : None.
+******************************************************************************/
+void Scale_Delay_Helper(void* Param)
+{
+    while(1)
+        vTaskDelay(ROUND_NUM+1000U+(TickType_t)(size_t)Param);
+}
+
+void Scale_Delay_Setup(void)
+{
+    Helper_Create(Scale_Delay_Helper,SCALE_NUM(Bench_Cur->Arg),BENCH_HELPER_PRIO);
+}
+
+void Scale_Delay_Send(uint32_t Round)
+{
+    /* Read counter here */
+    End=TEST_CNT_READ();
+    TEST_DATA();
+    xTaskAbortDelay(Thd_2);
+}
+
+void Scale_Delay_Recv(uint32_t Round)
+{
+    /* Read counter here */
+    Start=TEST_CNT_READ();
+    vTaskDelay(TIMER_IDLE_PERIOD);
+}
+/* End Function:Bench_Scale_Delay ********************************************/
+
+/* Function:Bench_Scale_Tick **************************************************
+Description : The tick task count scaling test. Arg helpers delay for one tick
+              at a time, and the periodic interrupt stands in for the tick, so
+              all of them expire on every tick. Only the tick processing is
+              timed, in the interrupt.
+Input       : uint32_t Round - The current round.
+Output      : None.
+Return      : None.
+******************************************************************************/
+void Scale_Tick_Helper(void* Param)
+{
+    while(1)
+    {
+        vTaskDelay(1U);
+        Helper_Done++;
+    }
+}
+
+void Scale_Tick_Setup(void)
+{
+    Helper_Create(Scale_Tick_Helper,SCALE_NUM(Bench_Cur->Arg),BENCH_HELPER_PRIO);
+}
+
+void Scale_Tick_ISR(void)
+{
+    UBaseType_t Mask;
+    BaseType_t Task_Woke;
+    BaseType_t Recv_Woke=pdFALSE;
+
+    Mask=portSET_INTERRUPT_MASK_FROM_ISR();
+    Start=TEST_CNT_READ();
+    Task_Woke=xTaskIncrementTick();
+    End=TEST_CNT_READ();
+    portCLEAR_INTERRUPT_MASK_FROM_ISR(Mask);
+    TEST_DATA();
+
+    xTaskNotifyFromISR(Thd_2,1U,eSetValueWithOverwrite,&Recv_Woke);
+    portYIELD_FROM_ISR((Task_Woke!=pdFALSE)||(Recv_Woke!=pdFALSE));
+}
+
+void Scale_Tick_Recv(uint32_t Round)
+{
+    uint32_t Data;
+
+    /* The helpers are above the receiver, so they are all delayed again */
+    xTaskNotifyWait(0x00,0xFFFFFFFF,&Data,portMAX_DELAY);
+    if(Helper_Done!=Helper_Num)
+    {
+        Print_Str("Tick scaling error @ round ");
+        Print_Int(Round);
+        Print_Str(".\r\n");
+    }
+    Helper_Done=0U;
+    Flip=0U;
+}
+/* End Function:Bench_Scale_Tick *********************************************/
+
+/* Function:Bench_Tick ********************************************************
+Description : The tick cost tests. The periodic interrupt stands in for the
+              tick and times xTaskIncrementTick alone, with Arg helpers delayed
+              past the end of the test, or with two helpers spinning below the
+              receiver so that, with configUSE_TIME_SLICING, every tick asks
+              for a switch between them. The catch-up test pends Arg ticks with
+              the scheduler suspended and times the xTaskResumeAll that
+              processes them. After each interrupt test, the share of the CPU
+              that the tick would take at configTICK_RATE_HZ is printed.
+Input       : uint32_t Round - The current round.
+Output      : None.
+Return      : None.
+******************************************************************************/
+void Tick_Slice_Helper(void* Param)
+{
+    while(1);
+}
+
+void Tick_Slice_Setup(void)
+{
+    /* The sender is blocked, so these two share the bottom priority */
+    Helper_Create(Tick_Slice_Helper,Bench_Cur->Arg,1U);
+}
+
+void Tick_Recv(uint32_t Round)
+{
+    uint32_t Data;
+
+    xTaskNotifyWait(0x00,0xFFFFFFFF,&Data,portMAX_DELAY);
+    Flip=0U;
+}
+
+void Tick_Pended_Recv(uint32_t Round)
+{
+    uint32_t Count;
+
+    vTaskSuspendAll();
+    for(Count=0U;Count<Bench_Cur->Arg;Count++)
+    {
+        /* These only count up uxPendedTicks while suspended */
+        taskENTER_CRITICAL();
+        xTaskIncrementTick();
+        taskEXIT_CRITICAL();
+    }
+    /* Read counter here */
+    Start=TEST_CNT_READ();
+    xTaskResumeAll();
+    End=TEST_CNT_READ();
+    TEST_DATA();
+}
+
+void Tick_Teardown(void)
+{
+    uint32_t Share;
+
+    Helper_Delete();
+
+    /* In hundredths of a percent */
+    Share=(uint32_t)(((Total/Bench_Cur->Rounds)*configTICK_RATE_HZ*10000U)/TEST_CNT_HZ);
+    Print_Str("    Share of CPU at tick rate     : ");
+    Print_Int(Share/100U);
+    Print_Str(".");
+    Print_Int((Share%100U)/10U);
+    Print_Int(Share%10U);
+    Print_Str("%\r\n");
+}
+/* End Function:Bench_Tick ***************************************************/
+
+#ifdef BENCH_PHASE
+/* Function:Thru_Account ******************************************************
+Description : Charge the time since the last switch to the task that ran, and
+              note the task that runs next. Called at every switch while a
+              throughput test is being traced.
+Input       : uint32_t Now - The timestamp of the switch.
+Output      : None.
+Return      : None.
+******************************************************************************/
+void Thru_Account(uint32_t Now)
+{
+    uint32_t Slot;
+    TaskHandle_t Task;
+    
+    Thru_Busy[Thru_Slot]+=(Now-Thru_Last)&TEST_CNT_MASK;
+    Thru_Last=Now;
+    Task=xTaskGetCurrentTaskHandle();
+    /* Anything that is not a helper goes to the last slot */
+    for(Slot=0U;Slot<Helper_Num;Slot++)
+    {
+        if(Thd_Helper[Slot]==Task)
+            break;
+    }
+    Thru_Slot=Slot;
+}
+/* End Function:Thru_Account *************************************************/
+#endif
+
+/* Function:Bench_Phase *******************************************************
+Description : The ISR phase breakdown. The periodic interrupt notifies the
+              receiver and yields to it, stamping its entry and either side of
+              the FromISR call; with BENCH_PHASE the kernel also stamps the
+              switch as the receiver is switched in. The phase in Arg is then
+              timed from these, where the IRQ phases need the board to tell
+              how long ago the interrupt was raised. With PHASE_MASKED, a
+              helper below the receiver sits in back-to-back critical
+              sections, so the interrupt often waits for one to end.
+Input       : uint32_t Round - The current round.
+Output      : None.
+Return      : None.
+******************************************************************************/
+void Phase_Switch_Mark(void)
+{
+    Phase_Switch=TEST_CNT_READ();
+#ifdef BENCH_PHASE
+    if(Thru_Trace!=0U)
+        Thru_Account(Phase_Switch);
+#endif
+}
+
+void Phase_Mask_Helper(void* Param)
+{
+    uint32_t Count;
+    
+    while(1)
+    {
+        taskENTER_CRITICAL();
+        for(Count=0U;Count<PHASE_MASK_SPIN;Count++)
+            Phase_Spin++;
+        taskEXIT_CRITICAL();
+    }
+}
+
+void Phase_Setup(void)
+{
+    if((Bench_Cur->Arg&PHASE_MASKED)!=0U)
+        Helper_Create(Phase_Mask_Helper,1U,1U);
+}
+
+void Phase_ISR(void)
+{
+    BaseType_t Task_Woke=pdFALSE;
+    
+#ifdef TEST_INT_LATENCY
+    Phase_Entry=TEST_CNT_READ();
+    Phase_Irq=TEST_INT_LATENCY();
+#endif
+    Phase_Api_Start=TEST_CNT_READ();
+    xTaskNotifyFromISR(Thd_2,1U,eSetValueWithOverwrite,&Task_Woke);
+    Phase_Api_End=TEST_CNT_READ();
+    portYIELD_FROM_ISR(Task_Woke);
+}
+
+void Phase_Recv(uint32_t Round)
+{
+    uint32_t Data;
+    uint32_t Now;
+    
+    xTaskNotifyWait(0x00,0xFFFFFFFF,&Data,portMAX_DELAY);
+    /* Read counter here */
+    Now=TEST_CNT_READ();
+    
+    switch(Bench_Cur->Arg&0xFFFFU)
+    {
+        case PHASE_IRQ:
+        {
+            Start=0U;
+            End=Phase_Irq;
+            break;
+        }
+        case PHASE_TOTAL:
+        {
+            Start=Phase_Entry-Phase_Irq;
+            End=Now;
+            break;
+        }
+        case PHASE_API:
+        {
+            Start=Phase_Api_Start;
+            End=Phase_Api_End;
+            break;
+        }
+        case PHASE_YIELD:
+        {
+            Start=Phase_Api_End;
+            End=Now;
+            break;
+        }
+        case PHASE_SWITCH:
+        {
+            Start=Phase_Api_End;
+            End=Phase_Switch;
+            break;
+        }
+        default:
+        {
+            Start=Phase_Switch;
+            End=Now;
+            break;
+        }
+    }
+    TEST_DATA();
+    Flip=0U;
+}
+/* End Function:Bench_Phase **************************************************/
+
+/* Function:Bench_Crit ********************************************************
+Description : The critical section and scheduler lock tests. The first times
+              an enter/exit pair at a nesting depth of Arg. The second times a
+              suspend/resume pair with nothing pended, or, with Arg helpers
+              woken while the scheduler is suspended, the resume that moves
+              them off the pending ready list. The helpers are below the
+              receiver so that the resume does not switch to them; the
+              receiver then drops below them for a moment to let them block
+              again.
+Input       : uint32_t Round - The current round.
+Output      : None.
+Return      : None.
+******************************************************************************/
+void Crit_Nest_Recv(uint32_t Round)
+{
+    uint32_t Count;
+    
+    /* Read counter here */
+    Start=TEST_CNT_READ();
+    for(Count=0U;Count<Bench_Cur->Arg;Count++)
+        taskENTER_CRITICAL();
+    for(Count=0U;Count<Bench_Cur->Arg;Count++)
+        taskEXIT_CRITICAL();
+    End=TEST_CNT_READ();
+    TEST_DATA();
+}
+
+void Sched_Pend_Helper(void* Param)
+{
+    while(1)
+    {
+        xSemaphoreTake(Sem_Pend,portMAX_DELAY);
+        Helper_Done++;
+    }
+}
+
+void Sched_Pend_Setup(void)
+{
+    Helper_Create(Sched_Pend_Helper,Bench_Cur->Arg,1U);
+    Helper_Drain();
+}
+
+void Sched_Recv(uint32_t Round)
+{
+    uint32_t Count;
+    
+    if(Bench_Cur->Arg==0U)
+    {
+        /* Read counter here */
+        Start=TEST_CNT_READ();
+        vTaskSuspendAll();
+        xTaskResumeAll();
+        End=TEST_CNT_READ();
+        TEST_DATA();
+        return;
+    }
+    
+    vTaskSuspendAll();
+    for(Count=0U;Count<Bench_Cur->Arg;Count++)
+        xSemaphoreGive(Sem_Pend);
+    /* Read counter here */
+    Start=TEST_CNT_READ();
+    xTaskResumeAll();
+    End=TEST_CNT_READ();
+    TEST_DATA();
+    
+    Helper_Drain();
+    if(Helper_Done!=Bench_Cur->Arg)
+    {
+        Print_Str("Scheduler lock error @ round ");
+        Print_Int(Round);
+        Print_Str(".\r\n");
+    }
+    Helper_Done=0U;
+}
+/* End Function:Bench_Crit ***************************************************/
+
+/* Function:Bench_Life_Create *************************************************
+Description : The task creation tests. A task below the receiver is created
+              and then deleted again without ever running, either from the
+              heap with Arg times the minimal stack, or from static memory.
+              The stack is filled with tskSTACK_FILL_BYTE when the high water
+              mark or the stack overflow check needs it, so the cost of each
+              extra stack byte is printed after the largest stack.
+Input       : uint32_t Round - The current round.
+Output      : None.
+Return      : None.
+******************************************************************************/
+void Life_Park_Helper(void* Param)
+{
+    while(1)
+        vTaskSuspend(NULL);
+}
+
+void Life_Create_Recv(uint32_t Round)
+{
+    TaskHandle_t Task;
+    BaseType_t Retval;
+    
+    /* Read counter here */
+    Start=TEST_CNT_READ();
+    Retval=xTaskCreate(Life_Park_Helper,"Life",configMINIMAL_STACK_SIZE*Bench_Cur->Arg,
+                       NULL,1U,&Task);
+    End=TEST_CNT_READ();
+    TEST_DATA();
+    
+    if(Retval!=pdPASS)
+    {
+        Print_Str("Task creation error @ round ");
+        Print_Int(Round);
+        Print_Str(".\r\n");
+        return;
+    }
+    vTaskDelete(Task);
+}
+
+void Life_Static_Recv(uint32_t Round)
+{
+    TaskHandle_t Task;
+    
+    /* Read counter here */
+    Start=TEST_CNT_READ();
+    Task=xTaskCreateStatic(Life_Park_Helper,"Life",configMINIMAL_STACK_SIZE,
+                           NULL,1U,Life_Stack,&Life_Tcb);
+    End=TEST_CNT_READ();
+    TEST_DATA();
+    
+    vTaskDelete(Task);
+}
+
+void Life_Create_Teardown(void)
+{
+    uint32_t Slope;
+    
+    if(Bench_Cur->Arg==1U)
+        Life_Base=Min;
+    else
+    {
+        /* In hundredths of a cycle */
+        Slope=(Min>Life_Base)?((Min-Life_Base)*100U/
+              ((Bench_Cur->Arg-1U)*configMINIMAL_STACK_SIZE*sizeof(StackType_t))):0U;
+        Print_Str("    Cycles per extra stack byte   : ");
+        Print_Int(Slope/100U);
+        Print_Str(".");
+        Print_Int((Slope%100U)/10U);
+        Print_Int(Slope%10U);
+        Print_Str("\r\n");
+    }
+}
+/* End Function:Bench_Life_Create ********************************************/
+
+/* Function:Bench_Life_Delete *************************************************
+Description : The task deletion tests. Deleting another task frees it at once.
+              A task that deletes itself is instead left for the idle task to
+              free, so after each of these the receiver suspends itself and
+              the idle hook resumes it, which lets the idle task run once. The
+              delete is timed from the call to the receiver running, and the
+              reclaim from the receiver suspending to the idle hook, after the
+              idle task has freed it; the idle round trip is the same with
+              nothing to free.
+Input       : uint32_t Round - The current round.
+Output      : None.
+Return      : None.
+******************************************************************************/
+void Life_Delete_Recv(uint32_t Round)
+{
+    TaskHandle_t Task;
+    
+    if(xTaskCreate(Life_Park_Helper,"Life",configMINIMAL_STACK_SIZE,NULL,1U,&Task)!=pdPASS)
+    {
+        Print_Str("Task creation error @ round ");
+        Print_Int(Round);
+        Print_Str(".\r\n");
+        return;
+    }
+    
+    /* Read counter here */
+    Start=TEST_CNT_READ();
+    vTaskDelete(Task);
+    End=TEST_CNT_READ();
+    TEST_DATA();
+}
+
+void Life_Self_Helper(void* Param)
+{
+    /* Read counter here */
+    Start=TEST_CNT_READ();
+    vTaskDelete(NULL);
+}
+
+void vApplicationIdleHook(void)
+{
+    if(Life_Idle_Wait!=0U)
+    {
+        End=TEST_CNT_READ();
+        Life_Idle_Wait=0U;
+        vTaskResume(Thd_2);
+    }
+}
+
+void Life_Self_Recv(uint32_t Round)
+{
+    if(Bench_Cur->Arg!=LIFE_IDLE)
+    {
+        /* The helper is above the receiver, so it deletes itself at once */
+        if(xTaskCreate(Life_Self_Helper,"Life",configMINIMAL_STACK_SIZE,NULL,
+                       BENCH_HELPER_PRIO,NULL)!=pdPASS)
+        {
+            Print_Str("Task creation error @ round ");
+            Print_Int(Round);
+            Print_Str(".\r\n");
+            return;
+        }
+        if(Bench_Cur->Arg==LIFE_DELETE)
+        {
+            End=TEST_CNT_READ();
+            TEST_DATA();
+        }
+    }
+    
+    /* Read counter here */
+    Start=TEST_CNT_READ();
+    Life_Idle_Wait=1U;
+    vTaskSuspend(NULL);
+    if(Bench_Cur->Arg!=LIFE_DELETE)
+        TEST_DATA();
+}
+/* End Function:Bench_Life_Delete ********************************************/
+
+/* Function:Bench_Life_Sched **************************************************
+Description : The task suspend, resume and priority tests. A helper below the
+              receiver is suspended and resumed, or moved to the idle priority
+              and back, without a switch. A helper above it is resumed, or
+              raised above it from below, and timed until it runs; it then
+              suspends itself, or drops back, for the next round.
+Input       : uint32_t Round - The current round.
+Output      : None.
+Return      : None.
+******************************************************************************/
+void Life_Resume_Helper(void* Param)
+{
+    while(1)
+    {
+        vTaskSuspend(NULL);
+        End=TEST_CNT_READ();
+        TEST_DATA();
+    }
+}
+
+void Life_Prio_Helper(void* Param)
+{
+    while(1)
+    {
+        End=TEST_CNT_READ();
+        TEST_DATA();
+        vTaskPrioritySet(NULL,1U);
+    }
+}
+
+void Life_Park_Setup(void)
+{
+    Helper_Create(Life_Park_Helper,1U,1U);
+}
+
+void Life_Resume_Setup(void)
+{
+    /* This runs at once and suspends itself */
+    Helper_Create(Life_Resume_Helper,1U,BENCH_HELPER_PRIO);
+}
+
+void Life_Prio_Setup(void)
+{
+    Helper_Create(Life_Prio_Helper,1U,1U);
+}
+
+void Life_Suspend_Recv(uint32_t Round)
+{
+    /* Read counter here */
+    Start=TEST_CNT_READ();
+    vTaskSuspend(Thd_Helper[0]);
+    vTaskResume(Thd_Helper[0]);
+    End=TEST_CNT_READ();
+    TEST_DATA();
+}
+
+void Life_Resume_Recv(uint32_t Round)
+{
+    /* Read counter here */
+    Start=TEST_CNT_READ();
+    vTaskResume(Thd_Helper[0]);
+}
+
+void Life_Prio_Recv(uint32_t Round)
+{
+    /* Read counter here */
+    Start=TEST_CNT_READ();
+    vTaskPrioritySet(Thd_Helper[0],0U);
+    vTaskPrioritySet(Thd_Helper[0],1U);
+    End=TEST_CNT_READ();
+    TEST_DATA();
+}
+
+void Life_Prio_Switch_Recv(uint32_t Round)
+{
+    /* Read counter here */
+    Start=TEST_CNT_READ();
+    vTaskPrioritySet(Thd_Helper[0],BENCH_HELPER_PRIO);
+}
+/* End Function:Bench_Life_Sched *********************************************/
+
+/* Function:Bench_Fpu *********************************************************
+Description : The FPU context tests. The sender and the receiver are two fresh
+              helpers rather than the two benchmark tasks, because a task
+              that has used the FPU once keeps its FPU context for good, and
+              the other tests would then pay for it. Each of them, and the
+              interrupt, does a float operation every round if its flag is in
+              Arg, outside of the timed part except for the interrupt, where
+              it is the lazy stacking that is timed. The sender yields to the
+              receiver, or notifies it from below; in the interrupt tests the
+              sender spins to be interrupted instead. The receiver reports to
+              the benchmark receiver after every sample, and the difference
+              to the integer case is printed after each test.
+Input       : uint32_t Round - The current round.
+Output      : None.
+Return      : None.
+******************************************************************************/
+void Fpu_Use(void)
+{
+    Fpu_Val=Fpu_Val*0.5F+1.0F;
+}
+
+void Fpu_Helper(void* Param)
+{
+    uint32_t Kind;
+    
+    Kind=FPU_KIND(Bench_Cur->Arg);
+    /* The sender */
+    if(Param==(void*)0U)
+    {
+        while(1)
+        {
+            if((Bench_Cur->Arg&FPU_SEND)!=0U)
+                Fpu_Use();
+            if(Kind==FPU_YIELD)
+            {
+                /* Read counter here */
+                Start=TEST_CNT_READ();
+                taskYIELD();
+            }
+            else if(Kind==FPU_NOTIFY)
+            {
+                /* Read counter here */
+                Start=TEST_CNT_READ();
+                xTaskNotifyGive(Thd_Helper[1]);
+            }
+        }
+    }
+    
+    /* The receiver - it may have been picked before the sender, and then it
+     * yields to it once, so that every sample starts with a sender's stamp */
+    if(Kind==FPU_YIELD)
+        taskYIELD();
+    while(1)
+    {
+        if(Kind!=FPU_YIELD)
+            ulTaskNotifyTake(pdTRUE,portMAX_DELAY);
+        End=TEST_CNT_READ();
+        TEST_DATA();
+        if((Bench_Cur->Arg&FPU_RECV)!=0U)
+            Fpu_Use();
+        xTaskNotifyGive(Thd_2);
+    }
+}
+
+void Fpu_Setup(void)
+{
+    /* Both start below the benchmark receiver, so that neither runs yet */
+    Helper_Create(Fpu_Helper,2U,1U);
+    if(FPU_KIND(Bench_Cur->Arg)!=FPU_YIELD)
+        vTaskPrioritySet(Thd_Helper[1],BENCH_HELPER_PRIO);
+}
+
+void Fpu_ISR(void)
+{
+    BaseType_t Task_Woke=pdFALSE;
+    
+    /* Read counter here */
+    Start=TEST_CNT_READ();
+    if((Bench_Cur->Arg&FPU_ISR)!=0U)
+        Fpu_Use();
+    vTaskNotifyGiveFromISR(Thd_Helper[1],&Task_Woke);
+    portYIELD_FROM_ISR(Task_Woke);
+}
+
+void Fpu_Recv(uint32_t Round)
+{
+    ulTaskNotifyTake(pdTRUE,portMAX_DELAY);
+    Flip=0U;
+}
+
+void Fpu_Teardown(void)
+{
+    uint32_t Kind;
+    
+    Helper_Delete();
+    
+    Kind=FPU_KIND(Bench_Cur->Arg);
+    if((Bench_Cur->Arg&FPU_USE_ALL)==0U)
+        Fpu_Base[Kind]=Min;
+    else
+    {
+        Print_Str("    Extra cycles over integer     : ");
+        if(Min<Fpu_Base[Kind])
+            Print_Str("0");
+        else
+            Print_Int(Min-Fpu_Base[Kind]);
+        Print_Str("\r\n");
+    }
+}
+/* End Function:Bench_Fpu ****************************************************/
+
+/* Function:Bench_Thru ********************************************************
+Description : The throughput tests. Producer helpers push THRU_TOTAL messages
+              through a queue, a counting semaphore or notifications to
+              consumer helpers, all released at once and left to run to the
+              end. The clock starts at the first message taken, so a
+              producer that runs alone before its consumers is not part of
+              any sample, and every THRU_BATCH messages taken after it is one
+              sample; the first is one message short. The queue is short,
+              so a producer that is not below its consumers soon meets
+              backpressure; a semaphore or notification producer yields
+              every THRU_QUEUE_LEN messages instead, so at equal priority
+              it never runs further ahead than a queue producer would. The
+              whole stream runs in the first round, and the rest only
+              return. With the switch trace, the CPU time of every helper is
+              also accounted.
+Input       : uint32_t Round - The current round.
+Output      : None.
+Return      : None.
+******************************************************************************/
+void Thru_Helper(void* Param)
+{
+    uint32_t Index;
+    uint32_t Obj;
+    uint32_t Prod;
+    uint32_t Cons;
+    uint32_t Count;
+    uint32_t Data;
+    
+    Index=(uint32_t)(size_t)Param;
+    Obj=THRU_OBJ(Bench_Cur->Arg);
+    Prod=THRU_PROD(Bench_Cur->Arg);
+    Cons=THRU_CONS(Bench_Cur->Arg);
+    
+    /* Wait for the release */
+    vTaskSuspend(NULL);
+    
+    if(Index<Prod)
+    {
+        for(Count=0U;Count<THRU_TOTAL/Prod;Count++)
+        {
+            if(Obj==THRU_QUEUE)
+                xQueueSend(Queue_Thru,&Count,portMAX_DELAY);
+            else if(Obj==THRU_SEM)
+                xSemaphoreGive(Sem_Thru);
+            else
+                xTaskNotifyGive(Thd_Helper[Prod+(Count%Cons)]);
+            
+            /* A give never blocks and there is no tick, so without this the
+             * producer would post the whole stream before its consumers run */
+            if((Obj!=THRU_QUEUE)&&(((Count+1U)%THRU_QUEUE_LEN)==0U))
+                taskYIELD();
+        }
+    }
+    else
+    {
+        for(Count=0U;Count<THRU_TOTAL/Cons;Count++)
+        {
+            if(Obj==THRU_QUEUE)
+                xQueueReceive(Queue_Thru,&Data,portMAX_DELAY);
+            else if(Obj==THRU_SEM)
+                xSemaphoreTake(Sem_Thru,portMAX_DELAY);
+            else
+                ulTaskNotifyTake(pdFALSE,portMAX_DELAY);
+            
+            /* There is no time slicing, so only one consumer is ever here */
+            Thru_Done++;
+            if(Thru_Done==1U)
+                Start=TEST_CNT_READ();
+            else if((Thru_Done%THRU_BATCH)==0U)
+            {
+                End=TEST_CNT_READ();
+                TEST_DATA();
+                Start=End;
+            }
+        }
+        
+        if(Thru_Done==THRU_TOTAL)
+        {
+#ifdef BENCH_PHASE
+            Thru_Account(TEST_CNT_READ());
+            Thru_Trace=0U;
+#endif
+            xTaskNotifyGive(Thd_2);
+        }
+    }
+    
+    while(1)
+        vTaskSuspend(NULL);
+}
+
+void Thru_Setup(void)
+{
+    uint32_t Prod;
+    uint32_t Count;
+    
+    Prod=THRU_PROD(Bench_Cur->Arg);
+    Helper_Create(Thru_Helper,Prod+THRU_CONS(Bench_Cur->Arg),1U);
+    Helper_Drain();
+    
+    /* They are all suspended now, so they can be raised without running */
+    for(Count=0U;Count<Helper_Num;Count++)
+    {
+        if(((THRU_PRIO(Bench_Cur->Arg)==THRU_PROD_HIGH)&&(Count<Prod))||
+           ((THRU_PRIO(Bench_Cur->Arg)==THRU_CONS_HIGH)&&(Count>=Prod)))
+            vTaskPrioritySet(Thd_Helper[Count],BENCH_HELPER_PRIO);
+    }
+}
+
+void Thru_Recv(uint32_t Round)
+{
+    uint32_t Count;
+    
+    if(Round!=0U)
+        return;
+    
+    Thru_Done=0U;
+    vTaskSuspendAll();
+    for(Count=0U;Count<Helper_Num;Count++)
+        vTaskResume(Thd_Helper[Count]);
+#ifdef BENCH_PHASE
+    for(Count=0U;Count<=THRU_TASK_MAX;Count++)
+        Thru_Busy[Count]=0U;
+    Thru_Last=TEST_CNT_READ();
+    Thru_Slot=Helper_Num;
+    Thru_Trace=1U;
+#endif
+    xTaskResumeAll();
+    
+    ulTaskNotifyTake(pdTRUE,portMAX_DELAY);
+}
+
+void Thru_Teardown(void)
+{
+#ifdef BENCH_PHASE
+    uint32_t Count;
+    uint32_t Num;
+    uint32_t Share;
+    uint64_t Busy;
+#endif
+    
+    Helper_Delete();
+    
+    /* The results are per message already */
+    Print_Str("    Messages per second           : ");
+    Print_Int((uint32_t)(((uint64_t)TEST_CNT_HZ*ROUND_NUM)/(Total!=0U?Total:1U)));
+    Print_Str("\r\n");
+    
+#ifdef BENCH_PHASE
+    Busy=0U;
+    for(Count=0U;Count<=THRU_TASK_MAX;Count++)
+        Busy+=Thru_Busy[Count];
+    if(Busy==0U)
+        return;
+    
+    /* The helpers are gone, but their slots are still there */
+    Num=THRU_PROD(Bench_Cur->Arg)+THRU_CONS(Bench_Cur->Arg);
+    for(Count=0U;Count<=Num;Count++)
+    {
+        if(Count==Num)
+            Print_Str("    CPU share of other tasks      : ");
+        else
+        {
+            Print_Str((Count<THRU_PROD(Bench_Cur->Arg))?"    CPU share of producer ":
+                                                          "    CPU share of consumer ");
+            Print_Int((Count<THRU_PROD(Bench_Cur->Arg))?(Count+1U):(Count-THRU_PROD(Bench_Cur->Arg)+1U));
+            Print_Str("       : ");
+        }
+        /* In hundredths of a percent */
+        Share=(uint32_t)((Thru_Busy[Count]*10000U)/Busy);
+        Print_Int(Share/100U);
+        Print_Str(".");
+        Print_Int((Share%100U)/10U);
+        Print_Int(Share%10U);
+        Print_Str("%\r\n");
+    }
+#endif
+}
+/* End Function:Bench_Thru ***************************************************/
+
+/* Function:vApplicationGetIdleTaskMemory *************************************
+Description : Give the idle task its memory, as static allocation is on.
+Input       : None.
+Output      : StaticTask_t** ppxIdleTaskTCBBuffer - The control block.
+              StackType_t** ppxIdleTaskStackBuffer - The stack.
+              uint32_t* pulIdleTaskStackSize - The stack depth in words.
+Return      : None.
+******************************************************************************/
+void vApplicationGetIdleTaskMemory(StaticTask_t** ppxIdleTaskTCBBuffer,
+                                   StackType_t** ppxIdleTaskStackBuffer,
+                                   uint32_t* pulIdleTaskStackSize)
+{
+    *ppxIdleTaskTCBBuffer=&Idle_Tcb;
+    *ppxIdleTaskStackBuffer=Idle_Stack;
+    *pulIdleTaskStackSize=configMINIMAL_STACK_SIZE;
+}
+/* End Function:vApplicationGetIdleTaskMemory ********************************/
+
+/* Function:vApplicationGetTimerTaskMemory ************************************
+Description : Give the timer daemon its memory, as static allocation is on.
+Input       : None.
+Output      : StaticTask_t** ppxTimerTaskTCBBuffer - The control block.
+              StackType_t** ppxTimerTaskStackBuffer - The stack.
+              uint32_t* pulTimerTaskStackSize - The stack depth in words.
+Return      : None.
+******************************************************************************/
+void vApplicationGetTimerTaskMemory(StaticTask_t** ppxTimerTaskTCBBuffer,
+                                    StackType_t** ppxTimerTaskStackBuffer,
+                                    uint32_t* pulTimerTaskStackSize)
+{
+    *ppxTimerTaskTCBBuffer=&Timer_Tcb;
+    *ppxTimerTaskStackBuffer=Timer_Stack;
+    *pulTimerTaskStackSize=configTIMER_TASK_STACK_DEPTH;
+}
+/* End Function:vApplicationGetTimerTaskMemory *******************************/
+
+#ifdef TEST_MEM_POOL
+/* Function:Bench_Mem_Pool ****************************************************
+Description : The memory pool test. Each round allocates eight blocks of random
+              sizes and then frees them in random order, so it is counted as
+              eight operations.
+Input       : uint32_t Round - The current round.
+Output      : None.
+Return      : None.
+******************************************************************************/
+static void* Mem[8];
+static uint32_t Alloc[8];
+static uint32_t Free[8];
+static uint32_t Size[8];
+static uint32_t Amount[8];
+
+int32_t Rand(void)
+{
+    static uint32_t LFSR=0xACE1U;
+    
+    if((LFSR&0x01U)!=0U)
+    {
+        LFSR>>=1;
+        LFSR^=0xB400U;
+    }
+    else
+        LFSR>>=1;
+    
+    return LFSR;
+}
+
+void Swap(uint32_t* Arg1, uint32_t* Arg2)
+{
+    uint32_t Temp;
+    
+    Temp=*Arg1;
+    *Arg1=*Arg2;
+    *Arg2=Temp;
+}
+
+void Mem_Pool_Setup(void)
+{
+    Amount[0]=(TEST_MEM_POOL/32U)*sizeof(uint32_t);
+    Amount[1]=(TEST_MEM_POOL/64U+16U)*sizeof(uint32_t);
+    Amount[2]=(TEST_MEM_POOL/4U)*sizeof(uint32_t);
+    Amount[3]=(TEST_MEM_POOL/128U+32U)*sizeof(uint32_t);
+    Amount[4]=(TEST_MEM_POOL/16U)*sizeof(uint32_t);
+    Amount[5]=(TEST_MEM_POOL/8U+16U)*sizeof(uint32_t);
+    Amount[6]=(TEST_MEM_POOL/128U+64U)*sizeof(uint32_t);
+    Amount[7]=(TEST_MEM_POOL/2U-256U)*sizeof(uint32_t);
+}
+
+void Mem_Pool_Recv(uint32_t Round)
+{
+    int32_t Case_Cnt;
+    
+    /* Random sequence and number generation */
+    for(Case_Cnt=0;Case_Cnt<8;Case_Cnt++)
+    {
+        Alloc[Case_Cnt]=(uint8_t)Case_Cnt;
+        Free[Case_Cnt]=(uint8_t)Case_Cnt;
+        Size[Case_Cnt]=(uint8_t)Case_Cnt;
+    }
+    
+    for(Case_Cnt=7;Case_Cnt>0;Case_Cnt--)
+    {
+        Swap(&Alloc[Case_Cnt], &Alloc[Rand()%((uint32_t)Case_Cnt+1U)]);
+        Swap(&Free[Case_Cnt], &Free[Rand()%((uint32_t)Case_Cnt+1U)]);
+        Swap(&Size[Case_Cnt], &Size[Rand()%((uint32_t)Case_Cnt+1U)]);
+    }
+    
+    Start=TEST_CNT_READ();
+    /* Allocation tests - one of the mallocs may fail if because the management data
+     * structure takes up some space. However, the first four must be successful. */
+    Mem[Alloc[0]]=pvPortMalloc(Amount[Size[0]]);
+    if(Mem[Alloc[0]]==NULL) Print_Str("Failure.\r\n");
+    Mem[Alloc[1]]=pvPortMalloc(Amount[Size[1]]);
+    if(Mem[Alloc[0]]==NULL) Print_Str("Failure.\r\n");
+    Mem[Alloc[2]]=pvPortMalloc(Amount[Size[2]]);
+    if(Mem[Alloc[0]]==NULL) Print_Str("Failure.\r\n");
+    Mem[Alloc[3]]=pvPortMalloc(Amount[Size[3]]);
+    if(Mem[Alloc[0]]==NULL) Print_Str("Failure.\r\n");
+    Mem[Alloc[4]]=pvPortMalloc(Amount[Size[4]]);
+    if(Mem[Alloc[0]]==NULL) Print_Str("Failure.\r\n");
+    Mem[Alloc[5]]=pvPortMalloc(Amount[Size[5]]);
+    if(Mem[Alloc[0]]==NULL) Print_Str("Failure.\r\n");
+    Mem[Alloc[6]]=pvPortMalloc(Amount[Size[6]]);
+    if(Mem[Alloc[0]]==NULL) Print_Str("Failure.\r\n");
+    Mem[Alloc[7]]=pvPortMalloc(Amount[Size[7]]);
+    if(Mem[Alloc[0]]==NULL) Print_Str("Failure.\r\n");
+
+    /* Deallocation tests */
+    vPortFree(Mem[Free[0]]);
+    vPortFree(Mem[Free[1]]);
+    vPortFree(Mem[Free[2]]);
+    vPortFree(Mem[Free[3]]);
+    vPortFree(Mem[Free[4]]);
+    vPortFree(Mem[Free[5]]);
+    vPortFree(Mem[Free[6]]);
+    vPortFree(Mem[Free[7]]);
+    End=TEST_CNT_READ();
+    TEST_DATA();
+
+    /* This should always be successful because we deallocated everything else, and
+     * management data structure should never take up more than 1/8 of the pool. */
+    Mem[0]=pvPortMalloc(TEST_MEM_POOL*sizeof(uint32_t)*7U/8U);
+    if(Mem[0]==NULL)
+    {
+        Print_Str("Memory test failure: ");
+        Print_Int(Round);
+        Print_Str(" runs.\r\n");
+        while(1);
+    }
+    vPortFree(Mem[0]);
+}
+/* End Function:Bench_Mem_Pool ***********************************************/
+#endif
+
+/* Function:Bench_Heap ********************************************************
+Description : The heap tests. A workload holds the heap near HEAP_FILL percent
+              of the bytes free at the setup: below that, it allocates a block
+              of a size from the distribution in Arg, and at or above it, it
+              frees a random live block; the long-lived blocks of the lifetime
+              mix are only freed now and then. The live blocks are kept at the
+              front of the table, so a pick takes constant time. The same seed
+              is used for every test and every heap, and either each malloc or
+              each free is timed on its own, or batches of HEAP_AGE_BATCH
+              operations are timed while the fragmentation is checked at every
+              quarter of the run, all at the target fill. A failed malloc is
+              only counted, and the average is over the calls that were made.
+              With heap_1, which cannot free, the workload stops at the target
+              fill, and the heap it took is not given back to the tests after
+              it.
+Input       : uint32_t Round - The current round.
+Output      : None.
+Return      : None.
+******************************************************************************/
+static void* Heap_Slot[HEAP_SLOT_NUM];
+static uint16_t Heap_Size[HEAP_SLOT_NUM];
+static uint32_t Heap_Num;
+static uint32_t Heap_Seed;
+static uint32_t Heap_Live;
+static uint32_t Heap_Peak;
+static uint32_t Heap_Fail;
+static uint32_t Heap_Base;
+static uint32_t Heap_Target;
+static uint32_t Heap_Min_Free;
+static uint32_t Heap_Samples;
+static uint32_t Heap_Frag[HEAP_AGE_CHECK];
+
+uint32_t Heap_Rand(void)
+{
+    /* xorshift32 - the 16-bit LFSR of the pool test repeats too soon */
+    Heap_Seed^=Heap_Seed<<13;
+    Heap_Seed^=Heap_Seed>>17;
+    Heap_Seed^=Heap_Seed<<5;
+    return Heap_Seed;
+}
+
+uint32_t Heap_Dist_Size(uint32_t Dist)
+{
+    if(Dist==HEAP_CHURN)
+        return 8U+Heap_Rand()%57U;
+    if(Dist==HEAP_BIMODAL)
+    {
+        /* One in eight is large */
+        if((Heap_Rand()%8U)!=0U)
+            return 16U+Heap_Rand()%49U;
+        return HEAP_LARGE_MIN+Heap_Rand()%(HEAP_LARGE_MAX-HEAP_LARGE_MIN);
+    }
+    return 16U+Heap_Rand()%256U;
+}
+
+/* The largest free block over all free bytes, in hundredths of a percent */
+uint32_t Heap_Frag_Get(void)
+{
+#if(BENCH_HEAP==3U)
+    return 0U;
+#else
+    size_t Free;
+    size_t Largest;
+    
+    Free=xPortGetFreeHeapSize();
+#if(BENCH_HEAP==1U)
+    /* heap_1 only ever cuts from the end */
+    Largest=Free;
+#else
+    Largest=xPortGetLargestFreeBlockSize();
+#endif
+    if(Free==0U)
+        return 0U;
+    return (uint32_t)(((uint64_t)Largest*10000U)/Free);
+#endif
+}
+
+/* The heap bytes free, or what is left of the budget for heap_3 */
+uint32_t Heap_Free_Get(void)
+{
+#if(BENCH_HEAP==3U)
+    return Heap_Base-Heap_Live;
+#else
+    return (uint32_t)xPortGetFreeHeapSize();
+#endif
+}
+
+/* Take a live block off the table, moving the last one into its slot */
+void Heap_Slot_Drop(uint32_t Slot)
+{
+    Heap_Live-=Heap_Size[Slot]&~HEAP_LONG_FLAG;
+    Heap_Num--;
+    Heap_Slot[Slot]=Heap_Slot[Heap_Num];
+    Heap_Size[Slot]=Heap_Size[Heap_Num];
+    Heap_Slot[Heap_Num]=NULL;
+}
+
+uint32_t Heap_Op(uint32_t Dist)
+{
+    uint32_t Slot;
+    uint32_t Size;
+    uint32_t Free;
+    void* Mem;
+    
+    if(((Heap_Base-Heap_Free_Get())>=Heap_Target)&&(Heap_Num!=0U))
+    {
+#if(BENCH_HEAP!=1U)
+        /* A long-lived block picked is mostly kept, and another one picked */
+        do
+        {
+            Slot=Heap_Rand()%Heap_Num;
+        }
+        while(((Heap_Size[Slot]&HEAP_LONG_FLAG)!=0U)&&((Heap_Rand()%HEAP_LONG_ODDS)!=0U));
+        
+        Mem=Heap_Slot[Slot];
+        /* Read counter here */
+        Start=TEST_CNT_READ();
+        vPortFree(Mem);
+        End=TEST_CNT_READ();
+        Heap_Slot_Drop(Slot);
+        return HEAP_FREE;
+#else
+        /* Nothing can be freed, so the workload stops here */
+        return HEAP_FULL;
+#endif
+    }
+    
+    if(Heap_Num==HEAP_SLOT_NUM)
+        return HEAP_NONE;
+    
+    Size=Heap_Dist_Size(Dist);
+    /* Read counter here */
+    Start=TEST_CNT_READ();
+    Mem=pvPortMalloc(Size);
+    End=TEST_CNT_READ();
+    if(Mem==NULL)
+    {
+        Heap_Fail++;
+        return HEAP_FAIL;
+    }
+    
+    Heap_Slot[Heap_Num]=Mem;
+    Heap_Size[Heap_Num]=(uint16_t)Size;
+    if((Dist==HEAP_LIFETIME)&&((Heap_Rand()%HEAP_LONG_SHARE)==0U))
+        Heap_Size[Heap_Num]|=HEAP_LONG_FLAG;
+    Heap_Num++;
+    Heap_Live+=Size;
+    if(Heap_Live>Heap_Peak)
+        Heap_Peak=Heap_Live;
+    Free=Heap_Free_Get();
+    if(Free<Heap_Min_Free)
+        Heap_Min_Free=Free;
+    return HEAP_MALLOC;
+}
+
+void Heap_Setup(void)
+{
+    uint32_t Count;
+    
+    for(Count=0U;Count<HEAP_SLOT_NUM;Count++)
+        Heap_Slot[Count]=NULL;
+    Heap_Num=0U;
+    Heap_Seed=0x2545F491U;
+    Heap_Live=0U;
+    Heap_Peak=0U;
+    Heap_Fail=0U;
+    Heap_Samples=0U;
+#if(BENCH_HEAP==3U)
+    /* The C library heap has no statistics, so the budget is the heap size */
+    Heap_Base=configTOTAL_HEAP_SIZE;
+#else
+    Heap_Base=(uint32_t)xPortGetFreeHeapSize();
+#endif
+    Heap_Target=(uint32_t)(((uint64_t)Heap_Base*HEAP_FILL)/100U);
+    Heap_Min_Free=Heap_Base;
+}
+
+void Heap_Recv(uint32_t Round)
+{
+    uint32_t Op;
+    
+    /* Run the workload up to the next call of the side timed */
+    do
+    {
+        Op=Heap_Op(HEAP_DIST(Bench_Cur->Arg));
+    }
+    while((Op!=HEAP_SIDE(Bench_Cur->Arg))&&(Op!=HEAP_FAIL)&&(Op!=HEAP_FULL));
+    if(Op==HEAP_SIDE(Bench_Cur->Arg))
+    {
+        TEST_DATA();
+        Heap_Samples++;
+    }
+    
+    /* The results are printed over all rounds, so scale them up to the calls
+     * that were made */
+    if((Round==Bench_Cur->Rounds-1U)&&(Heap_Samples!=Bench_Cur->Rounds))
+    {
+        if(Heap_Samples==0U)
+            Min=0U;
+        else
+        {
+            Total=(Total*Bench_Cur->Rounds)/Heap_Samples;
+            Sq_Total=(Sq_Total/Heap_Samples)*Bench_Cur->Rounds;
+        }
+    }
+}
+
+void Heap_Age_Recv(uint32_t Round)
+{
+    uint32_t Count;
+    uint32_t Begin;
+    
+    /* Read counter here */
+    Begin=TEST_CNT_READ();
+    for(Count=0U;Count<HEAP_AGE_BATCH;Count++)
+        Heap_Op(HEAP_DIST(Bench_Cur->Arg));
+    End=TEST_CNT_READ();
+    Start=Begin;
+    TEST_DATA();
+    
+    if(((Round+1U)%(ROUND_NUM/HEAP_AGE_CHECK))==0U)
+        Heap_Frag[(Round+1U)/(ROUND_NUM/HEAP_AGE_CHECK)-1U]=Heap_Frag_Get();
+}
+
+void Heap_Percent_Print(uint32_t Share)
+{
+    Print_Int(Share/100U);
+    Print_Str(".");
+    Print_Int((Share%100U)/10U);
+    Print_Int(Share%10U);
+    Print_Str("%\r\n");
+}
+
+void Heap_Teardown(void)
+{
+    uint32_t Count;
+    
+    Print_Str("    Failed allocations            : ");
+    Print_Int(Heap_Fail);
+    Print_Str("\r\n");
+    Print_Str("    Peak live bytes               : ");
+    Print_Int(Heap_Peak);
+    Print_Str("\r\n");
+#if(BENCH_HEAP!=3U)
+    Print_Str("    Free bytes at start / min     : ");
+    Print_Int(Heap_Base);
+    Print_Str(" / ");
+    Print_Int(Heap_Min_Free);
+    Print_Str("\r\n");
+#endif
+#if((BENCH_HEAP==4U)||(BENCH_HEAP==5U))
+    Print_Str("    Min ever free since boot      : ");
+    Print_Int(xPortGetMinimumEverFreeHeapSize());
+    Print_Str("\r\n");
+#endif
+#if(BENCH_HEAP!=3U)
+    if(HEAP_SIDE(Bench_Cur->Arg)==HEAP_AGE)
+    {
+        for(Count=0U;Count<HEAP_AGE_CHECK;Count++)
+        {
+            Print_Str("    Largest/total free, ");
+            Print_Int(Count+1U);
+            Print_Str("/");
+            Print_Int(HEAP_AGE_CHECK);
+            Print_Str(" run   : ");
+            Heap_Percent_Print(Heap_Frag[Count]);
+        }
+    }
+    else
+    {
+        Print_Str("    Largest/total free            : ");
+        Heap_Percent_Print(Heap_Frag_Get());
+    }
+#endif
+    
+#if(BENCH_HEAP!=1U)
+    for(Count=0U;Count<HEAP_SLOT_NUM;Count++)
+    {
+        if(Heap_Slot[Count]!=NULL)
+            vPortFree(Heap_Slot[Count]);
+    }
+#endif
+}
+/* End Function:Bench_Heap ***************************************************/
+
+/* Function:Bench_Multi *******************************************************
+Description : The multi-wait tests. The receiver waits for any of Arg sources
+              with one of four mechanisms: binary semaphores in a queue set,
+              notification bits, event group bits, or flag bits behind one
+              binary semaphore that is only given when the first flag is
+              raised. From a task, the sender posts one source per round in
+              turn, and the latency runs until the receiver knows which one
+              it was. From an interrupt, all sources are posted at once and
+              each sample is divided by their number, which shows what each
+              event costs when the mechanism can or cannot fold them into one
+              wake-up. The heap that the objects take is printed after the
+              result.
+Input       : uint32_t Round - The current round.
+Output      : None.
+Return      : None.
+******************************************************************************/
+void Multi_Setup(void)
+{
+    uint32_t Count;
+    uint32_t Num;
+#if(BENCH_HEAP!=3U)
+    size_t Free;
+    
+    Free=xPortGetFreeHeapSize();
+#endif
+    Num=MULTI_NUM(Bench_Cur->Arg);
+    switch(MULTI_OBJ(Bench_Cur->Arg))
+    {
+#if(configUSE_QUEUE_SETS==1)
+        case MULTI_SET:
+        {
+            /* Each binary semaphore holds one item, so that is the set length */
+            Multi_Set=xQueueCreateSet(Num);
+            for(Count=0U;Count<Num;Count++)
+            {
+                Multi_Src[Count]=xSemaphoreCreateBinary();
+                xQueueAddToSet(Multi_Src[Count],Multi_Set);
+            }
+            break;
+        }
+#endif
+        case MULTI_NOTIFY:
+        {
+            /* The notification is in the TCB already - drop what is left */
+            xTaskNotifyWait(0x00,0xFFFFFFFF,NULL,0U);
+            break;
+        }
+        case MULTI_EVENT:
+        {
+            Multi_Event=xEventGroupCreate();
+            break;
+        }
+        default:
+        {
+            Multi_Bin=xSemaphoreCreateBinary();
+            Multi_Flag=0U;
+            break;
+        }
+    }
+#if(BENCH_HEAP!=3U)
+    Multi_Ram=(uint32_t)(Free-xPortGetFreeHeapSize());
+#endif
+}
+
+uint32_t Multi_Post(uint32_t Source, BaseType_t* Task_Woke)
+{
+    BaseType_t Retval;
+    UBaseType_t Mask;
+    uint32_t Flag;
+    
+    Retval=pdPASS;
+    switch(MULTI_OBJ(Bench_Cur->Arg))
+    {
+        case MULTI_SET:
+        {
+            if(Task_Woke==NULL)
+                Retval=xSemaphoreGive(Multi_Src[Source]);
+            else
+                Retval=xSemaphoreGiveFromISR(Multi_Src[Source],Task_Woke);
+            break;
+        }
+        case MULTI_NOTIFY:
+        {
+            if(Task_Woke==NULL)
+                Retval=xTaskNotify(Thd_2,1U<<Source,eSetBits);
+            else
+                Retval=xTaskNotifyFromISR(Thd_2,1U<<Source,eSetBits,Task_Woke);
+            break;
+        }
+        case MULTI_EVENT:
+        {
+            if(Task_Woke==NULL)
+                xEventGroupSetBits(Multi_Event,1U<<Source);
+#if((configUSE_TIMERS==1)&&(INCLUDE_xTimerPendFunctionCall==1))
+            else
+                Retval=xEventGroupSetBitsFromISR(Multi_Event,1U<<Source,Task_Woke);
+#endif
+            break;
+        }
+        default:
+        {
+            if(Task_Woke==NULL)
+            {
+                taskENTER_CRITICAL();
+                Flag=Multi_Flag;
+                Multi_Flag=Flag|(1U<<Source);
+                taskEXIT_CRITICAL();
+                if(Flag==0U)
+                    Retval=xSemaphoreGive(Multi_Bin);
+            }
+            else
+            {
+                Mask=taskENTER_CRITICAL_FROM_ISR();
+                Flag=Multi_Flag;
+                Multi_Flag=Flag|(1U<<Source);
+                taskEXIT_CRITICAL_FROM_ISR(Mask);
+                if(Flag==0U)
+                    Retval=xSemaphoreGiveFromISR(Multi_Bin,Task_Woke);
+            }
+            break;
+        }
+    }
+    
+    return (Retval==pdPASS)?0U:1U;
+}
+
+uint32_t Multi_Wait(void)
+{
+    uint32_t Bits;
+#if(configUSE_QUEUE_SETS==1)
+    uint32_t Count;
+    QueueSetMemberHandle_t Member;
+#endif
+    
+    switch(MULTI_OBJ(Bench_Cur->Arg))
+    {
+#if(configUSE_QUEUE_SETS==1)
+        case MULTI_SET:
+        {
+            /* Which source it was has to be looked up */
+            Member=xQueueSelectFromSet(Multi_Set,portMAX_DELAY);
+            for(Count=0U;Count<MULTI_NUM(Bench_Cur->Arg);Count++)
+            {
+                if(Member==Multi_Src[Count])
+                {
+                    xSemaphoreTake(Multi_Src[Count],0U);
+                    return 1U<<Count;
+                }
+            }
+            return 0U;
+        }
+#endif
+        case MULTI_NOTIFY:
+        {
+            xTaskNotifyWait(0x00,0xFFFFFFFF,&Bits,portMAX_DELAY);
+            return Bits;
+        }
+        case MULTI_EVENT:
+        {
+            return (uint32_t)xEventGroupWaitBits(Multi_Event,MULTI_ALL(Bench_Cur->Arg),
+                                                 pdTRUE,pdFALSE,portMAX_DELAY);
+        }
+        default:
+        {
+            xSemaphoreTake(Multi_Bin,portMAX_DELAY);
+            taskENTER_CRITICAL();
+            Bits=Multi_Flag;
+            Multi_Flag=0U;
+            taskEXIT_CRITICAL();
+            return Bits;
+        }
+    }
+}
+
+void Multi_Send(uint32_t Round)
+{
+    /* Read counter here */
+    Start=TEST_CNT_READ();
+    if(Multi_Post(Round%MULTI_NUM(Bench_Cur->Arg),NULL)!=0U)
+        Print_Str("Multi-wait post failed.\r\n");
+}
+
+void Multi_ISR(void)
+{
+    uint32_t Count;
+    uint32_t Fail;
+    BaseType_t Task_Woke=pdFALSE;
+    
+    Fail=0U;
+    Start=TEST_CNT_READ();
+    for(Count=0U;Count<MULTI_NUM(Bench_Cur->Arg);Count++)
+        Fail+=Multi_Post(Count,&Task_Woke);
+    portYIELD_FROM_ISR(Task_Woke);
+    if(Fail!=0U)
+        Print_Str("ISR multi-wait post failed.\r\n");
+}
+
+void Multi_Recv(uint32_t Round)
+{
+    uint32_t Want;
+    uint32_t Seen;
+    
+    if(Bench_Cur->Mode==BENCH_ISR)
+        Want=MULTI_ALL(Bench_Cur->Arg);
+    else
+        Want=1U<<(Round%MULTI_NUM(Bench_Cur->Arg));
+    
+    /* Mechanisms that do not fold events together wake once for each */
+    Seen=0U;
+    while((Seen&Want)!=Want)
+        Seen|=Multi_Wait();
+    /* Read counter here */
+    End=TEST_CNT_READ();
+    TEST_DATA();
+    
+    if(Seen!=Want)
+    {
+        Print_Str("Multi-wait error @ round ");
+        Print_Int(Round);
+        Print_Str(".\r\n");
+    }
+    Flip=0U;
+}
+
+void Multi_Teardown(void)
+{
+#if(configUSE_QUEUE_SETS==1)
+    uint32_t Count;
+#endif
+    
+    switch(MULTI_OBJ(Bench_Cur->Arg))
+    {
+#if(configUSE_QUEUE_SETS==1)
+        case MULTI_SET:
+        {
+            for(Count=0U;Count<MULTI_NUM(Bench_Cur->Arg);Count++)
+            {
+                xQueueRemoveFromSet(Multi_Src[Count],Multi_Set);
+                vSemaphoreDelete(Multi_Src[Count]);
+            }
+            vQueueDelete(Multi_Set);
+            break;
+        }
+#endif
+        case MULTI_NOTIFY:
+        {
+            /* Nothing was made */
+            break;
+        }
+        case MULTI_EVENT:
+        {
+            vEventGroupDelete(Multi_Event);
+            break;
+        }
+        default:
+        {
+            vSemaphoreDelete(Multi_Bin);
+            break;
+        }
+    }
+    
+#if(BENCH_HEAP!=3U)
+    Print_Str("    Heap bytes taken              : ");
+    Print_Int(Multi_Ram);
+    Print_Str("\r\n");
+#endif
+}
+/* End Function:Bench_Multi **************************************************/
+
+/* Function:Bench_Pipe ********************************************************
+Description : The pipeline tests. The periodic interrupt produces a sample,
+              a filter task above everything averages it with the ones before
+              it, an aggregator task below the filter gathers PIPE_BATCH of
+              them, and a logger task at the bottom takes each batch and
+              folds it into a sum. The links are queues or rings with a
+              notification, as Arg says, and each test records one stage: a
+              link, from the time a sample is put on it to the time the next
+              task has it, or the whole way from the interrupt to the log.
+              All samples go through in the first round, and the rest only
+              return. With the switch trace, the CPU time of every stage is
+              also accounted, as in the throughput tests.
+Input       : uint32_t Round - The current round.
+Output      : None.
+Return      : None.
+******************************************************************************/
+uint32_t Pipe_Put(uint32_t Link, const void* Item, BaseType_t* Task_Woke)
+{
+    BaseType_t Retval;
+    
+    if(PIPE_RING(Bench_Cur->Arg,Link)==0U)
+    {
+        /* Tasks wait for room, the interrupt cannot */
+        if(Task_Woke==NULL)
+            Retval=xQueueSend(Queue_Pipe[Link],Item,portMAX_DELAY);
+        else
+            Retval=xQueueSendFromISR(Queue_Pipe[Link],Item,Task_Woke);
+        return (Retval==pdPASS)?0U:1U;
+    }
+    
+    /* A ring has one writer and one reader, so the ends need no lock */
+    if(Link==PIPE_LINK_LOG)
+    {
+        if((Pipe_Head[Link]-Pipe_Tail[Link])>=PIPE_BATCH_DEPTH)
+            return 1U;
+        Pipe_Batch_Ring[Pipe_Head[Link]%PIPE_BATCH_DEPTH]=*(const struct Pipe_Batch_Struct*)Item;
+    }
+    else
+    {
+        if((Pipe_Head[Link]-Pipe_Tail[Link])>=PIPE_DEPTH)
+            return 1U;
+        Pipe_Ring[Link][Pipe_Head[Link]%PIPE_DEPTH]=*(const struct Pipe_Sample_Struct*)Item;
+    }
+    Pipe_Head[Link]++;
+    
+    /* The helper that reads a link has the same number */
+    if(Task_Woke==NULL)
+        xTaskNotifyGive(Thd_Helper[Link]);
+    else
+        vTaskNotifyGiveFromISR(Thd_Helper[Link],Task_Woke);
+    return 0U;
+}
+
+void Pipe_Get(uint32_t Link, void* Item)
+{
+    if(PIPE_RING(Bench_Cur->Arg,Link)==0U)
+    {
+        xQueueReceive(Queue_Pipe[Link],Item,portMAX_DELAY);
+        return;
+    }
+    
+    ulTaskNotifyTake(pdFALSE,portMAX_DELAY);
+    if(Link==PIPE_LINK_LOG)
+        *(struct Pipe_Batch_Struct*)Item=Pipe_Batch_Ring[Pipe_Tail[Link]%PIPE_BATCH_DEPTH];
+    else
+        *(struct Pipe_Sample_Struct*)Item=Pipe_Ring[Link][Pipe_Tail[Link]%PIPE_DEPTH];
+    Pipe_Tail[Link]++;
+}
+
+void Pipe_Stage(uint32_t Stage, uint32_t Stamp, uint32_t Now)
+{
+    if(PIPE_STAGE(Bench_Cur->Arg)==Stage)
+    {
+        Start=Stamp;
+        End=Now;
+        TEST_DATA();
+    }
+}
+
+void Pipe_Helper(void* Param)
+{
+    uint32_t Index;
+    uint32_t Count;
+    uint32_t Now;
+    uint32_t Sum;
+    struct Pipe_Sample_Struct Sample;
+    
+    Index=(uint32_t)(size_t)Param;
+    while(1)
+    {
+        if(Index==PIPE_LINK_FILTER)
+        {
+            Pipe_Get(PIPE_LINK_FILTER,&Sample);
+            Now=TEST_CNT_READ();
+            Pipe_Stage(PIPE_LINK_FILTER,Sample.Stamp[PIPE_LINK_FILTER],Now);
+            /* The first stage has picked it up before the next interrupt */
+            Flip=0U;
+            
+            /* Moving average over the last PIPE_TAPS samples */
+            Pipe_Tap[Sample.Seq%PIPE_TAPS]=Sample.Value;
+            Sum=0U;
+            for(Count=0U;Count<PIPE_TAPS;Count++)
+                Sum+=Pipe_Tap[Count];
+            Sample.Value=Sum/PIPE_TAPS;
+            
+            Sample.Stamp[PIPE_LINK_AGG]=TEST_CNT_READ();
+            if(Pipe_Put(PIPE_LINK_AGG,&Sample,NULL)!=0U)
+                Print_Str("Pipeline aggregator overrun.\r\n");
+        }
+        else if(Index==PIPE_LINK_AGG)
+        {
+            Pipe_Get(PIPE_LINK_AGG,&Sample);
+            Now=TEST_CNT_READ();
+            Pipe_Stage(PIPE_LINK_AGG,Sample.Stamp[PIPE_LINK_AGG],Now);
+            
+            Pipe_Agg.Sample[Pipe_Agg.Num]=Sample;
+            Pipe_Agg.Num++;
+            /* A short batch at the end if the rounds do not divide */
+            if((Pipe_Agg.Num==PIPE_BATCH)||(Sample.Seq==Bench_Cur->Rounds-1U))
+            {
+                Now=TEST_CNT_READ();
+                for(Count=0U;Count<Pipe_Agg.Num;Count++)
+                    Pipe_Agg.Sample[Count].Stamp[PIPE_LINK_LOG]=Now;
+                if(Pipe_Put(PIPE_LINK_LOG,&Pipe_Agg,NULL)!=0U)
+                    Print_Str("Pipeline logger overrun.\r\n");
+                Pipe_Agg.Num=0U;
+            }
+        }
+        else
+        {
+            Pipe_Get(PIPE_LINK_LOG,&Pipe_Log);
+            Now=TEST_CNT_READ();
+            for(Count=0U;Count<Pipe_Log.Num;Count++)
+            {
+                Pipe_Stage(PIPE_LINK_LOG,Pipe_Log.Sample[Count].Stamp[PIPE_LINK_LOG],Now);
+                Pipe_Sum+=Pipe_Log.Sample[Count].Value;
+                Pipe_Stage(PIPE_TOTAL,Pipe_Log.Sample[Count].Stamp[PIPE_LINK_FILTER],TEST_CNT_READ());
+            }
+            
+            Pipe_Done+=Pipe_Log.Num;
+            if(Pipe_Done==Bench_Cur->Rounds)
+            {
+#ifdef BENCH_PHASE
+                Thru_Account(TEST_CNT_READ());
+                Thru_Trace=0U;
+#endif
+                xTaskNotifyGive(Thd_2);
+            }
+        }
+    }
+}
+
+void Pipe_Setup(void)
+{
+    uint32_t Link;
+    
+    for(Link=0U;Link<PIPE_LINK_NUM;Link++)
+    {
+        Pipe_Head[Link]=0U;
+        Pipe_Tail[Link]=0U;
+        if(PIPE_RING(Bench_Cur->Arg,Link)!=0U)
+            continue;
+        if(Link==PIPE_LINK_LOG)
+            Queue_Pipe[Link]=xQueueCreate(PIPE_BATCH_DEPTH,sizeof(struct Pipe_Batch_Struct));
+        else
+            Queue_Pipe[Link]=xQueueCreate(PIPE_DEPTH,sizeof(struct Pipe_Sample_Struct));
+    }
+    for(Link=0U;Link<PIPE_TAPS;Link++)
+        Pipe_Tap[Link]=0U;
+    Pipe_Agg.Num=0U;
+    Pipe_Done=0U;
+    /* Drop what the tests before may have left */
+    xTaskNotifyWait(0x00,0xFFFFFFFF,NULL,0U);
+    
+    /* All of them block on their links, then the filter goes to the top and
+     * the aggregator below it, while the logger stays at the bottom */
+    Helper_Create(Pipe_Helper,PIPE_LINK_NUM,1U);
+    Helper_Drain();
+    vTaskPrioritySet(Thd_Helper[PIPE_LINK_FILTER],BENCH_HELPER_PRIO+1U);
+    vTaskPrioritySet(Thd_Helper[PIPE_LINK_AGG],BENCH_HELPER_PRIO);
+}
+
+void Pipe_ISR(void)
+{
+    BaseType_t Task_Woke=pdFALSE;
+    struct Pipe_Sample_Struct Sample;
+    
+    /* The handler has already counted this round */
+    Sample.Seq=Int_Count-1U;
+    Sample.Value=Sample.Seq&0xFFU;
+    Sample.Stamp[PIPE_LINK_FILTER]=TEST_CNT_READ();
+    if(Pipe_Put(PIPE_LINK_FILTER,&Sample,&Task_Woke)!=0U)
+        Print_Str("ISR pipeline post failed.\r\n");
+    portYIELD_FROM_ISR(Task_Woke);
+}
+
+void Pipe_Recv(uint32_t Round)
+{
+#ifdef BENCH_PHASE
+    uint32_t Count;
+#endif
+    
+    if(Round!=0U)
+        return;
+    
+#ifdef BENCH_PHASE
+    taskENTER_CRITICAL();
+    for(Count=0U;Count<=THRU_TASK_MAX;Count++)
+        Thru_Busy[Count]=0U;
+    Thru_Last=TEST_CNT_READ();
+    Thru_Slot=Helper_Num;
+    Thru_Trace=1U;
+    taskEXIT_CRITICAL();
+#endif
+    
+    ulTaskNotifyTake(pdTRUE,portMAX_DELAY);
+}
+
+void Pipe_Teardown(void)
+{
+    uint32_t Link;
+#ifdef BENCH_PHASE
+    uint32_t Count;
+    uint32_t Share;
+    uint64_t Busy;
+    static const char* const Name[PIPE_LINK_NUM+1U]=
+    {
+        "    CPU share of filter           : ",
+        "    CPU share of aggregator       : ",
+        "    CPU share of logger           : ",
+        "    CPU share of other tasks      : "
+    };
+#endif
+    
+    Helper_Delete();
+    for(Link=0U;Link<PIPE_LINK_NUM;Link++)
+    {
+        if(PIPE_RING(Bench_Cur->Arg,Link)==0U)
+            vQueueDelete(Queue_Pipe[Link]);
+    }
+    
+#ifdef BENCH_PHASE
+    Busy=0U;
+    for(Count=0U;Count<=PIPE_LINK_NUM;Count++)
+        Busy+=Thru_Busy[Count];
+    if(Busy==0U)
+        return;
+    
+    /* The interrupt is charged to the task it interrupted */
+    for(Count=0U;Count<=PIPE_LINK_NUM;Count++)
+    {
+        Print_Str(Name[Count]);
+        /* In hundredths of a percent */
+        Share=(uint32_t)((Thru_Busy[Count]*10000U)/Busy);
+        Print_Int(Share/100U);
+        Print_Str(".");
+        Print_Int((Share%100U)/10U);
+        Print_Int(Share%10U);
+        Print_Str("%\r\n");
+    }
+#endif
+}
+/* End Function:Bench_Pipe ***************************************************/
+
+/* Function:Bench_Period ******************************************************
+Description : The periodic task tests. The periodic interrupt stands in for the
+              tick and stamps when each tick was due, taking away the interrupt
+              latency where the board can read it. PERIOD_TASK_NUM helpers at
+              rate-monotonic priorities loop on vTaskDelayUntil, and each
+              release times how late the task started and how long until its
+              work was done, both from the tick it was due on. The receiver
+              sleeps through it all in round 0, then the first task's release
+              goes out as the result of the test and the teardown prints the
+              rest, with the releases each task found already overdue.
+Input       : uint32_t Round - The current round.
+Output      : None.
+Return      : None.
+******************************************************************************/
+void Period_Record(struct Period_Stat_Struct* Stat, uint32_t Due, uint32_t Now)
+{
+    uint32_t Lat;
+    
+    /* The tasks preempt each other, so the globals are no use here */
+    Lat=(Now-Due)&TEST_CNT_MASK;
+    Lat=Lat>Overhead?(Lat-Overhead):0U;
+    Stat->Total+=Lat;
+    Stat->Sq_Total+=((uint64_t)Lat)*Lat;
+    Stat->Max=Lat>Stat->Max?Lat:Stat->Max;
+    Stat->Min=Lat<Stat->Min?Lat:Stat->Min;
+    Hist_Record(&Stat->Hist,Lat);
+}
+
+void Period_Helper(void* Param)
+{
+    uint32_t Index;
+    uint32_t Period;
+    uint32_t Count;
+    uint32_t Due;
+    uint32_t Done;
+    volatile uint32_t Work;
+    TickType_t Last;
+    
+    Index=(uint32_t)(size_t)Param;
+    Period=Period_Set[Bench_Cur->Arg][Index];
+    Last=xTaskGetTickCount();
+    for(Count=0U;Count<ROUND_NUM;Count++)
+    {
+        vTaskDelayUntil(&Last,Period);
+        Due=Period_Stamp[Last%PERIOD_STAMP_NUM];
+        Period_Record(&Period_Stat[Index][PERIOD_RELEASE],Due,TEST_CNT_READ());
+        for(Work=0U;Work<PERIOD_WORK;Work++);
+        Period_Record(&Period_Stat[Index][PERIOD_RESPONSE],Due,TEST_CNT_READ());
+        /* The next release is due already, so it will not block */
+        if((xTaskGetTickCount()-Last)>=Period)
+            Period_Overrun[Index]++;
+    }
+    
+    taskENTER_CRITICAL();
+    Period_Done++;
+    Done=Period_Done;
+    taskEXIT_CRITICAL();
+    if(Done==PERIOD_TASK_NUM)
+        xTaskNotifyGive(Thd_2);
+    while(1)
+        vTaskSuspend(NULL);
+}
+
+void Period_Setup(void)
+{
+    uint32_t Index;
+    uint32_t Kind;
+    
+    for(Index=0U;Index<PERIOD_TASK_NUM;Index++)
+    {
+        for(Kind=0U;Kind<PERIOD_KIND_NUM;Kind++)
+        {
+            Period_Stat[Index][Kind].Total=0U;
+            Period_Stat[Index][Kind].Sq_Total=0U;
+            Period_Stat[Index][Kind].Max=0U;
+            Period_Stat[Index][Kind].Min=((uint32_t)-1U);
+            Hist_Clear(&Period_Stat[Index][Kind].Hist);
+        }
+        Period_Overrun[Index]=0U;
+    }
+    Period_Done=0U;
+    /* Drop what the tests before may have left */
+    xTaskNotifyWait(0x00,0xFFFFFFFF,NULL,0U);
+    
+    /* All of them take their first tick and block while the tick stands still,
+     * then the shortest period goes to the top */
+    Helper_Create(Period_Helper,PERIOD_TASK_NUM,1U);
+    Helper_Drain();
+    for(Index=0U;Index<PERIOD_TASK_NUM;Index++)
+        vTaskPrioritySet(Thd_Helper[Index],BENCH_HELPER_PRIO+1U-Index);
+}
+
+void Period_ISR(void)
+{
+    UBaseType_t Mask;
+    BaseType_t Task_Woke;
+    uint32_t Due;
+    TickType_t Tick;
+    
+    Due=TEST_CNT_READ();
+#ifdef TEST_INT_LATENCY
+    /* The tick was due when the timer fired, not when this got to run */
+    Due-=TEST_INT_LATENCY();
+#endif
+    Tick=xTaskGetTickCountFromISR()+1U;
+    Period_Stamp[Tick%PERIOD_STAMP_NUM]=Due;
+    
+    Mask=portSET_INTERRUPT_MASK_FROM_ISR();
+    Task_Woke=xTaskIncrementTick();
+    portCLEAR_INTERRUPT_MASK_FROM_ISR(Mask);
+    
+    /* No task answers each interrupt here */
+    Flip=0U;
+    portYIELD_FROM_ISR(Task_Woke);
+}
+
+void Period_Recv(uint32_t Round)
+{
+    if(Round!=0U)
+        return;
+    
+    ulTaskNotifyTake(pdTRUE,portMAX_DELAY);
+    Total=Period_Stat[0][PERIOD_RELEASE].Total;
+    Sq_Total=Period_Stat[0][PERIOD_RELEASE].Sq_Total;
+    Max=Period_Stat[0][PERIOD_RELEASE].Max;
+    Min=Period_Stat[0][PERIOD_RELEASE].Min;
+    *Hist=Period_Stat[0][PERIOD_RELEASE].Hist;
+}
+
+void Period_Teardown(void)
+{
+    uint32_t Index;
+    uint32_t Kind;
+    
+    Helper_Delete();
+    
+    for(Index=0U;Index<PERIOD_TASK_NUM;Index++)
+    {
+        for(Kind=0U;Kind<PERIOD_KIND_NUM;Kind++)
+        {
+            /* The first task's release went out as the test itself */
+            if((Index==0U)&&(Kind==PERIOD_RELEASE))
+                continue;
+            Total=Period_Stat[Index][Kind].Total;
+            Sq_Total=Period_Stat[Index][Kind].Sq_Total;
+            Max=Period_Stat[Index][Kind].Max;
+            Min=Period_Stat[Index][Kind].Min;
+            Hist=&Period_Stat[Index][Kind].Hist;
+            TEST_LIST(Period_Name[Bench_Cur->Arg][Index][Kind]);
+        }
+    }
+    Hist=&Hist_Data;
+    
+    Print_Str("    Overdue releases per task     : ");
+    for(Index=0U;Index<PERIOD_TASK_NUM;Index++)
+    {
+        if(Index!=0U)
+            Print_Str(" / ");
+        Print_Int(Period_Overrun[Index]);
+    }
+    Print_Str("\r\n");
+}
+/* End Function:Bench_Period *************************************************/
+
+/* Benchmark registry - every test is one entry here, and they run in this order.
+ * Entries are numbered from 0 for BENCH_SELECT and the console prompt. */
+const struct Bench_Struct Bench[]=
+{
+    {"Yield                             ",BENCH_SAME,ROUND_NUM,1U,0U,
+     NULL,Yield_Send,Yield_Recv,NULL,NULL},
+    {"Notification                      ",BENCH_HIGH,ROUND_NUM,1U,0U,
+     NULL,Notify_Send,Notify_Recv,NULL,NULL},
+    {"Semaphore                         ",BENCH_HIGH,ROUND_NUM,1U,0U,
+     NULL,Sem_Send,Sem_Recv,NULL,NULL},
+    {"Message queue                     ",BENCH_HIGH,ROUND_NUM,1U,0U,
+     NULL,Bmq_Send,Bmq_Recv,NULL,NULL},
+#if(defined(TEST_MEM_POOL)&&(BENCH_HEAP!=1U))
+    {"Memory allocation/free pair       ",BENCH_LOCAL,ROUND_NUM,8U,0U,
+     Mem_Pool_Setup,NULL,Mem_Pool_Recv,NULL,NULL},
+#endif
+    {"ISR Notification                  ",BENCH_ISR,ROUND_NUM,1U,0U,
+     NULL,NULL,Notify_Recv,Notify_ISR,NULL},
+    {"ISR Semaphore                     ",BENCH_ISR,ROUND_NUM,1U,0U,
+     NULL,NULL,Sem_Recv,Sem_ISR,NULL},
+    {"ISR Message queue                 ",BENCH_ISR,ROUND_NUM,1U,0U,
+     NULL,NULL,Bmq_Recv,Bmq_ISR,NULL},
+    {"Mutex take/give pair              ",BENCH_LOCAL,ROUND_NUM,1U,0U,
+     NULL,NULL,Mutex_Recv,NULL,NULL},
+    {"Mutex contended take (inherit)    ",BENCH_HIGH,ROUND_NUM,1U,0U,
+     NULL,Mutex_Cont_Send,Mutex_Cont_Recv,NULL,NULL},
+    {"Mutex handoff give (disinherit)   ",BENCH_HIGH,ROUND_NUM,1U,1U,
+     NULL,Mutex_Cont_Send,Mutex_Cont_Recv,NULL,NULL},
+    {"Recursive mutex depth 1           ",BENCH_LOCAL,ROUND_NUM,1U,1U,
+     NULL,NULL,Mutex_Rec_Recv,NULL,NULL},
+    {"Recursive mutex depth 4           ",BENCH_LOCAL,ROUND_NUM,4U,4U,
+     NULL,NULL,Mutex_Rec_Recv,NULL,NULL},
+    {"Recursive mutex depth 16          ",BENCH_LOCAL,ROUND_NUM,16U,16U,
+     NULL,NULL,Mutex_Rec_Recv,NULL,NULL},
+    {"Event set/wait                    ",BENCH_HIGH,ROUND_NUM,1U,1U,
+     Event_Setup,Event_Send,Event_Recv,NULL,Helper_Delete},
+    {"Event wake-all 4 tasks            ",BENCH_HIGH,ROUND_NUM,1U,4U,
+     Event_Setup,Event_Send,Event_Recv,NULL,Helper_Delete},
+#if(BENCH_HELPER_NUM>=15U)
+    {"Event wake-all 16 tasks           ",BENCH_HIGH,ROUND_NUM,1U,16U,
+     Event_Setup,Event_Send,Event_Recv,NULL,Helper_Delete},
+#endif
+#if((configUSE_TIMERS==1)&&(INCLUDE_xTimerPendFunctionCall==1))
+    {"ISR Event set/wait                ",BENCH_ISR,ROUND_NUM,1U,1U,
+     Event_Setup,NULL,Event_Recv,Event_ISR,Helper_Delete},
+    {"ISR Event wake-all 4 tasks        ",BENCH_ISR,ROUND_NUM,1U,4U,
+     Event_Setup,NULL,Event_Recv,Event_ISR,Helper_Delete},
+#if(BENCH_HELPER_NUM>=15U)
+    {"ISR Event wake-all 16 tasks       ",BENCH_ISR,ROUND_NUM,1U,16U,
+     Event_Setup,NULL,Event_Recv,Event_ISR,Helper_Delete},
+#endif
+#endif
+    {"Event sync 2 tasks                ",BENCH_LOCAL,ROUND_NUM,1U,2U,
+     Event_Sync_Setup,NULL,Event_Sync_Recv,NULL,Helper_Delete},
+    {"Event sync 4 tasks                ",BENCH_LOCAL,ROUND_NUM,1U,4U,
+     Event_Sync_Setup,NULL,Event_Sync_Recv,NULL,Helper_Delete},
+#if(BENCH_HELPER_NUM>=7U)
+    {"Event sync 8 tasks                ",BENCH_LOCAL,ROUND_NUM,1U,8U,
+     Event_Sync_Setup,NULL,Event_Sync_Recv,NULL,Helper_Delete},
+#endif
+#if(BENCH_HELPER_NUM>=15U)
+    {"Event sync 16 tasks               ",BENCH_LOCAL,ROUND_NUM,1U,16U,
+     Event_Sync_Setup,NULL,Event_Sync_Recv,NULL,Helper_Delete},
+#endif
+    {"Timer start command               ",BENCH_LOCAL,ROUND_NUM,1U,0U,
+     NULL,NULL,Timer_Start_Recv,NULL,Timer_Teardown},
+    {"Timer reset command               ",BENCH_LOCAL,ROUND_NUM,1U,0U,
+     Timer_Reset_Setup,NULL,Timer_Reset_Recv,NULL,Timer_Teardown},
+    {"Timer start, 16 active            ",BENCH_LOCAL,ROUND_NUM,1U,16U,
+     Timer_Setup,NULL,Timer_Start_Recv,NULL,Timer_Teardown},
+#if(BENCH_TIMER_NUM>=64U)
+    {"Timer start, 64 active            ",BENCH_LOCAL,ROUND_NUM,1U,64U,
+     Timer_Setup,NULL,Timer_Start_Recv,NULL,Timer_Teardown},
+#endif
+#if(BENCH_TIMER_NUM>=256U)
+    {"Timer start, 256 active           ",BENCH_LOCAL,ROUND_NUM,1U,256U,
+     Timer_Setup,NULL,Timer_Start_Recv,NULL,Timer_Teardown},
+#endif
+    {"ISR Timer one-shot expiry         ",BENCH_ISR,ROUND_NUM,1U,0U,
+     Timer_Expiry_Setup,NULL,Timer_Expiry_Recv,Timer_Expiry_ISR,Timer_Expiry_Teardown},
+    {"ISR Timer auto-reload expiry      ",BENCH_ISR,ROUND_NUM,1U,1U,
+     Timer_Expiry_Setup,NULL,Timer_Expiry_Recv,Timer_Expiry_ISR,Timer_Expiry_Teardown},
+    BENCH_QUEUE("Queue send/receive 4B             ",QUEUE_BACK,4U,1U),
+    BENCH_QUEUE("Queue send/receive 8B             ",QUEUE_BACK,8U,1U),
+    BENCH_QUEUE("Queue send/receive 16B            ",QUEUE_BACK,16U,1U),
+    BENCH_QUEUE("Queue send/receive 32B            ",QUEUE_BACK,32U,1U),
+    BENCH_QUEUE("Queue send/receive 64B            ",QUEUE_BACK,64U,1U),
+    BENCH_QUEUE("Queue send/receive 128B           ",QUEUE_BACK,128U,1U),
+    BENCH_QUEUE("Queue send/receive 256B           ",QUEUE_BACK,256U,1U),
+    BENCH_QUEUE("Queue front/receive 4B            ",QUEUE_FRONT,4U,1U),
+    BENCH_QUEUE("Queue front/receive 8B            ",QUEUE_FRONT,8U,1U),
+    BENCH_QUEUE("Queue front/receive 16B           ",QUEUE_FRONT,16U,1U),
+    BENCH_QUEUE("Queue front/receive 32B           ",QUEUE_FRONT,32U,1U),
+    BENCH_QUEUE("Queue front/receive 64B           ",QUEUE_FRONT,64U,1U),
+    BENCH_QUEUE("Queue front/receive 128B          ",QUEUE_FRONT,128U,1U),
+    BENCH_QUEUE("Queue front/receive 256B          ",QUEUE_FRONT,256U,1U),
+    BENCH_QUEUE("Queue overwrite/receive 4B        ",QUEUE_OVERWRITE,4U,1U),
+    BENCH_QUEUE("Queue overwrite/receive 8B        ",QUEUE_OVERWRITE,8U,1U),
+    BENCH_QUEUE("Queue overwrite/receive 16B       ",QUEUE_OVERWRITE,16U,1U),
+    BENCH_QUEUE("Queue overwrite/receive 32B       ",QUEUE_OVERWRITE,32U,1U),
+    BENCH_QUEUE("Queue overwrite/receive 64B       ",QUEUE_OVERWRITE,64U,1U),
+    BENCH_QUEUE("Queue overwrite/receive 128B      ",QUEUE_OVERWRITE,128U,1U),
+    BENCH_QUEUE("Queue overwrite/receive 256B      ",QUEUE_OVERWRITE,256U,1U),
+    BENCH_QUEUE("Queue peek 4B                     ",QUEUE_PEEK,4U,1U),
+    BENCH_QUEUE("Queue peek 8B                     ",QUEUE_PEEK,8U,1U),
+    BENCH_QUEUE("Queue peek 16B                    ",QUEUE_PEEK,16U,1U),
+    BENCH_QUEUE("Queue peek 32B                    ",QUEUE_PEEK,32U,1U),
+    BENCH_QUEUE("Queue peek 64B                    ",QUEUE_PEEK,64U,1U),
+    BENCH_QUEUE("Queue peek 128B                   ",QUEUE_PEEK,128U,1U),
+    BENCH_QUEUE("Queue peek 256B                   ",QUEUE_PEEK,256U,1U),
+    BENCH_QUEUE("Queue fill/drain depth 4          ",QUEUE_FILL,4U,8U),
+    BENCH_QUEUE("Queue fill/drain depth 16         ",QUEUE_FILL,16U,32U),
+    BENCH_QUEUE("Queue fill/drain depth 64         ",QUEUE_FILL,64U,128U),
+    {"Sem block, 1 waiting              ",BENCH_LOCAL,ROUND_NUM,1U,1U,
+     Scale_Sem_Setup,NULL,Scale_Sem_Recv,NULL,Helper_Delete},
+    {"Sem block, 4 waiting              ",BENCH_LOCAL,ROUND_NUM,1U,4U,
+     Scale_Sem_Setup,NULL,Scale_Sem_Recv,NULL,Helper_Delete},
+#if(BENCH_HELPER_NUM>=16U)
+    {"Sem block, 16 waiting             ",BENCH_LOCAL,ROUND_NUM,1U,16U,
+     Scale_Sem_Setup,NULL,Scale_Sem_Recv,NULL,Helper_Delete},
+#endif
+#if(BENCH_HELPER_NUM>=64U)
+    {"Sem block, 64 waiting             ",BENCH_LOCAL,ROUND_NUM,1U,64U,
+     Scale_Sem_Setup,NULL,Scale_Sem_Recv,NULL,Helper_Delete},
+#endif
+    {"Sem wake, 1 waiting               ",BENCH_LOCAL,ROUND_NUM,1U,SCALE_WAKE|1U,
+     Scale_Sem_Setup,NULL,Scale_Sem_Recv,NULL,Helper_Delete},
+    {"Sem wake, 4 waiting               ",BENCH_LOCAL,ROUND_NUM,1U,SCALE_WAKE|4U,
+     Scale_Sem_Setup,NULL,Scale_Sem_Recv,NULL,Helper_Delete},
+#if(BENCH_HELPER_NUM>=16U)
+    {"Sem wake, 16 waiting              ",BENCH_LOCAL,ROUND_NUM,1U,SCALE_WAKE|16U,
+     Scale_Sem_Setup,NULL,Scale_Sem_Recv,NULL,Helper_Delete},
+#endif
+#if(BENCH_HELPER_NUM>=64U)
+    {"Sem wake, 64 waiting              ",BENCH_LOCAL,ROUND_NUM,1U,SCALE_WAKE|64U,
+     Scale_Sem_Setup,NULL,Scale_Sem_Recv,NULL,Helper_Delete},
+#endif
+    {"Delay block, 1 delayed            ",BENCH_HIGH,ROUND_NUM,1U,1U,
+     Scale_Delay_Setup,Scale_Delay_Send,Scale_Delay_Recv,NULL,Helper_Delete},
+    {"Delay block, 4 delayed            ",BENCH_HIGH,ROUND_NUM,1U,4U,
+     Scale_Delay_Setup,Scale_Delay_Send,Scale_Delay_Recv,NULL,Helper_Delete},
+#if(BENCH_HELPER_NUM>=16U)
+    {"Delay block, 16 delayed           ",BENCH_HIGH,ROUND_NUM,1U,16U,
+     Scale_Delay_Setup,Scale_Delay_Send,Scale_Delay_Recv,NULL,Helper_Delete},
+#endif
+#if(BENCH_HELPER_NUM>=64U)
+    {"Delay block, 64 delayed           ",BENCH_HIGH,ROUND_NUM,1U,64U,
+     Scale_Delay_Setup,Scale_Delay_Send,Scale_Delay_Recv,NULL,Helper_Delete},
+#endif
+    {"ISR Tick, 1 expiring              ",BENCH_ISR,ROUND_NUM,1U,1U,
+     Scale_Tick_Setup,NULL,Scale_Tick_Recv,Scale_Tick_ISR,Helper_Delete},
+    {"ISR Tick, 4 expiring              ",BENCH_ISR,ROUND_NUM,1U,4U,
+     Scale_Tick_Setup,NULL,Scale_Tick_Recv,Scale_Tick_ISR,Helper_Delete},
+#if(BENCH_HELPER_NUM>=16U)
+    {"ISR Tick, 16 expiring             ",BENCH_ISR,ROUND_NUM,1U,16U,
+     Scale_Tick_Setup,NULL,Scale_Tick_Recv,Scale_Tick_ISR,Helper_Delete},
+#endif
+#if(BENCH_HELPER_NUM>=64U)
+    {"ISR Tick, 64 expiring             ",BENCH_ISR,ROUND_NUM,1U,64U,
+     Scale_Tick_Setup,NULL,Scale_Tick_Recv,Scale_Tick_ISR,Helper_Delete},
+#endif
+    {"ISR Tick, 0 delayed               ",BENCH_ISR,ROUND_NUM,1U,0U,
+     Scale_Delay_Setup,NULL,Tick_Recv,Scale_Tick_ISR,Tick_Teardown},
+    {"ISR Tick, 4 delayed               ",BENCH_ISR,ROUND_NUM,1U,4U,
+     Scale_Delay_Setup,NULL,Tick_Recv,Scale_Tick_ISR,Tick_Teardown},
+#if(BENCH_HELPER_NUM>=64U)
+    {"ISR Tick, 64 delayed              ",BENCH_ISR,ROUND_NUM,1U,64U,
+     Scale_Delay_Setup,NULL,Tick_Recv,Scale_Tick_ISR,Tick_Teardown},
+#endif
+    {"ISR Tick, 2 tasks sliced          ",BENCH_ISR,ROUND_NUM,1U,2U,
+     Tick_Slice_Setup,NULL,Tick_Recv,Scale_Tick_ISR,Tick_Teardown},
+    {"Tick catch-up, 1 pended           ",BENCH_LOCAL,ROUND_NUM,1U,1U,
+     NULL,NULL,Tick_Pended_Recv,NULL,NULL},
+    {"Tick catch-up, 16 pended          ",BENCH_LOCAL,ROUND_NUM,1U,16U,
+     NULL,NULL,Tick_Pended_Recv,NULL,NULL},
+#ifdef TEST_INT_LATENCY
+    {"ISR phase IRQ to handler          ",BENCH_ISR,ROUND_NUM,1U,PHASE_IRQ,
+     Phase_Setup,NULL,Phase_Recv,Phase_ISR,Helper_Delete},
+    {"ISR phase IRQ to task             ",BENCH_ISR,ROUND_NUM,1U,PHASE_TOTAL,
+     Phase_Setup,NULL,Phase_Recv,Phase_ISR,Helper_Delete},
+    {"ISR phase IRQ to handler, masked  ",BENCH_ISR,ROUND_NUM,1U,PHASE_MASKED|PHASE_IRQ,
+     Phase_Setup,NULL,Phase_Recv,Phase_ISR,Helper_Delete},
+    {"ISR phase IRQ to task, masked     ",BENCH_ISR,ROUND_NUM,1U,PHASE_MASKED|PHASE_TOTAL,
+     Phase_Setup,NULL,Phase_Recv,Phase_ISR,Helper_Delete},
+#endif
+    {"ISR phase FromISR call            ",BENCH_ISR,ROUND_NUM,1U,PHASE_API,
+     Phase_Setup,NULL,Phase_Recv,Phase_ISR,Helper_Delete},
+    {"ISR phase yield to task           ",BENCH_ISR,ROUND_NUM,1U,PHASE_YIELD,
+     Phase_Setup,NULL,Phase_Recv,Phase_ISR,Helper_Delete},
+#ifdef BENCH_PHASE
+    {"ISR phase yield to switch         ",BENCH_ISR,ROUND_NUM,1U,PHASE_SWITCH,
+     Phase_Setup,NULL,Phase_Recv,Phase_ISR,Helper_Delete},
+    {"ISR phase switch to task          ",BENCH_ISR,ROUND_NUM,1U,PHASE_RESUME,
+     Phase_Setup,NULL,Phase_Recv,Phase_ISR,Helper_Delete},
+#endif
+    {"Critical section, depth 1         ",BENCH_LOCAL,ROUND_NUM,1U,1U,
+     NULL,NULL,Crit_Nest_Recv,NULL,NULL},
+    {"Critical section, depth 4         ",BENCH_LOCAL,ROUND_NUM,4U,4U,
+     NULL,NULL,Crit_Nest_Recv,NULL,NULL},
+    {"Scheduler suspend/resume pair     ",BENCH_LOCAL,ROUND_NUM,1U,0U,
+     NULL,NULL,Sched_Recv,NULL,NULL},
+    {"Scheduler resume, 1 pending       ",BENCH_LOCAL,ROUND_NUM,1U,1U,
+     Sched_Pend_Setup,NULL,Sched_Recv,NULL,Helper_Delete},
+    {"Scheduler resume, 4 pending       ",BENCH_LOCAL,ROUND_NUM,1U,4U,
+     Sched_Pend_Setup,NULL,Sched_Recv,NULL,Helper_Delete},
+#if(BENCH_HELPER_NUM>=16U)
+    {"Scheduler resume, 16 pending      ",BENCH_LOCAL,ROUND_NUM,1U,16U,
+     Sched_Pend_Setup,NULL,Sched_Recv,NULL,Helper_Delete},
+#endif
+    {"Task create, dynamic              ",BENCH_LOCAL,ROUND_NUM,1U,1U,
+     NULL,NULL,Life_Create_Recv,NULL,Life_Create_Teardown},
+    {"Task create, dynamic, 4x stack    ",BENCH_LOCAL,ROUND_NUM,1U,4U,
+     NULL,NULL,Life_Create_Recv,NULL,Life_Create_Teardown},
+    {"Task create, static               ",BENCH_LOCAL,ROUND_NUM,1U,0U,
+     NULL,NULL,Life_Static_Recv,NULL,NULL},
+    {"Task delete, other                ",BENCH_LOCAL,ROUND_NUM,1U,0U,
+     NULL,NULL,Life_Delete_Recv,NULL,NULL},
+    {"Task delete, self                 ",BENCH_LOCAL,ROUND_NUM,1U,LIFE_DELETE,
+     NULL,NULL,Life_Self_Recv,NULL,NULL},
+    {"Idle reclaim, 1 task              ",BENCH_LOCAL,ROUND_NUM,1U,LIFE_RECLAIM,
+     NULL,NULL,Life_Self_Recv,NULL,NULL},
+    {"Idle round trip                   ",BENCH_LOCAL,ROUND_NUM,1U,LIFE_IDLE,
+     NULL,NULL,Life_Self_Recv,NULL,NULL},
+    {"Task suspend/resume pair          ",BENCH_LOCAL,ROUND_NUM,1U,0U,
+     Life_Park_Setup,NULL,Life_Suspend_Recv,NULL,Helper_Delete},
+    {"Task resume, with switch          ",BENCH_LOCAL,ROUND_NUM,1U,0U,
+     Life_Resume_Setup,NULL,Life_Resume_Recv,NULL,Helper_Delete},
+    {"Task priority set pair            ",BENCH_LOCAL,ROUND_NUM,1U,0U,
+     Life_Park_Setup,NULL,Life_Prio_Recv,NULL,Helper_Delete},
+    {"Task priority set, with switch    ",BENCH_LOCAL,ROUND_NUM,1U,0U,
+     Life_Prio_Setup,NULL,Life_Prio_Switch_Recv,NULL,Helper_Delete},
+    {"FPU Yield, integer                ",BENCH_LOCAL,ROUND_NUM,1U,FPU_ARG(FPU_YIELD,0U),
+     Fpu_Setup,NULL,Fpu_Recv,NULL,Fpu_Teardown},
+    {"FPU Yield, sender                 ",BENCH_LOCAL,ROUND_NUM,1U,FPU_ARG(FPU_YIELD,FPU_SEND),
+     Fpu_Setup,NULL,Fpu_Recv,NULL,Fpu_Teardown},
+    {"FPU Yield, both                   ",BENCH_LOCAL,ROUND_NUM,1U,FPU_ARG(FPU_YIELD,FPU_SEND|FPU_RECV),
+     Fpu_Setup,NULL,Fpu_Recv,NULL,Fpu_Teardown},
+    {"FPU Notification, integer         ",BENCH_LOCAL,ROUND_NUM,1U,FPU_ARG(FPU_NOTIFY,0U),
+     Fpu_Setup,NULL,Fpu_Recv,NULL,Fpu_Teardown},
+    {"FPU Notification, sender          ",BENCH_LOCAL,ROUND_NUM,1U,FPU_ARG(FPU_NOTIFY,FPU_SEND),
+     Fpu_Setup,NULL,Fpu_Recv,NULL,Fpu_Teardown},
+    {"FPU Notification, both            ",BENCH_LOCAL,ROUND_NUM,1U,FPU_ARG(FPU_NOTIFY,FPU_SEND|FPU_RECV),
+     Fpu_Setup,NULL,Fpu_Recv,NULL,Fpu_Teardown},
+    {"FPU ISR Notification, integer     ",BENCH_ISR,ROUND_NUM,1U,FPU_ARG(FPU_INT,0U),
+     Fpu_Setup,NULL,Fpu_Recv,Fpu_ISR,Fpu_Teardown},
+    {"FPU ISR Notification, tasks       ",BENCH_ISR,ROUND_NUM,1U,FPU_ARG(FPU_INT,FPU_SEND|FPU_RECV),
+     Fpu_Setup,NULL,Fpu_Recv,Fpu_ISR,Fpu_Teardown},
+    {"FPU ISR Notification, ISR         ",BENCH_ISR,ROUND_NUM,1U,FPU_ARG(FPU_INT,FPU_ISR),
+     Fpu_Setup,NULL,Fpu_Recv,Fpu_ISR,Fpu_Teardown},
+    {"FPU ISR Notification, all         ",BENCH_ISR,ROUND_NUM,1U,FPU_ARG(FPU_INT,FPU_USE_ALL),
+     Fpu_Setup,NULL,Fpu_Recv,Fpu_ISR,Fpu_Teardown},
+    BENCH_THRU("Throughput queue 1:1, equal       ",THRU_QUEUE,THRU_EQUAL,1U,1U),
+    BENCH_THRU("Throughput queue 1:1, cons high   ",THRU_QUEUE,THRU_CONS_HIGH,1U,1U),
+    BENCH_THRU("Throughput queue 1:1, prod high   ",THRU_QUEUE,THRU_PROD_HIGH,1U,1U),
+    BENCH_THRU("Throughput queue 1:4, equal       ",THRU_QUEUE,THRU_EQUAL,1U,4U),
+    BENCH_THRU("Throughput queue 4:1, equal       ",THRU_QUEUE,THRU_EQUAL,4U,1U),
+    BENCH_THRU("Throughput sem 1:1, equal         ",THRU_SEM,THRU_EQUAL,1U,1U),
+    BENCH_THRU("Throughput sem 1:1, cons high     ",THRU_SEM,THRU_CONS_HIGH,1U,1U),
+    BENCH_THRU("Throughput sem 1:4, equal         ",THRU_SEM,THRU_EQUAL,1U,4U),
+    BENCH_THRU("Throughput sem 4:1, equal         ",THRU_SEM,THRU_EQUAL,4U,1U),
+    BENCH_THRU("Throughput notify 1:1, equal      ",THRU_NOTIFY,THRU_EQUAL,1U,1U),
+    BENCH_THRU("Throughput notify 1:1, cons high  ",THRU_NOTIFY,THRU_CONS_HIGH,1U,1U),
+    BENCH_THRU("Throughput notify 1:4, equal      ",THRU_NOTIFY,THRU_EQUAL,1U,4U),
+    BENCH_THRU("Throughput notify 4:1, equal      ",THRU_NOTIFY,THRU_EQUAL,4U,1U),
+#ifdef TEST_MEM_POOL
+    BENCH_HEAP_TEST("Heap churn, malloc                ",HEAP_CHURN,HEAP_MALLOC),
+    BENCH_HEAP_TEST("Heap bimodal, malloc              ",HEAP_BIMODAL,HEAP_MALLOC),
+    BENCH_HEAP_TEST("Heap lifetime mix, malloc         ",HEAP_LIFETIME,HEAP_MALLOC),
+#if(BENCH_HEAP!=1U)
+    BENCH_HEAP_TEST("Heap churn, free                  ",HEAP_CHURN,HEAP_FREE),
+    BENCH_HEAP_TEST("Heap bimodal, free                ",HEAP_BIMODAL,HEAP_FREE),
+    BENCH_HEAP_TEST("Heap lifetime mix, free           ",HEAP_LIFETIME,HEAP_FREE),
+    BENCH_HEAP_TEST("Heap aging, churn                 ",HEAP_CHURN,HEAP_AGE),
+    BENCH_HEAP_TEST("Heap aging, bimodal               ",HEAP_BIMODAL,HEAP_AGE),
+    BENCH_HEAP_TEST("Heap aging, lifetime mix          ",HEAP_LIFETIME,HEAP_AGE),
+#endif
+#endif
+#if(configUSE_QUEUE_SETS==1)
+    BENCH_MULTI("Multi-wait queue set 2            ",MULTI_SET,2U),
+    BENCH_MULTI("Multi-wait queue set 4            ",MULTI_SET,4U),
+    BENCH_MULTI("Multi-wait queue set 8            ",MULTI_SET,8U),
+#endif
+    BENCH_MULTI("Multi-wait notify bits 2          ",MULTI_NOTIFY,2U),
+    BENCH_MULTI("Multi-wait notify bits 4          ",MULTI_NOTIFY,4U),
+    BENCH_MULTI("Multi-wait notify bits 8          ",MULTI_NOTIFY,8U),
+    BENCH_MULTI("Multi-wait event bits 2           ",MULTI_EVENT,2U),
+    BENCH_MULTI("Multi-wait event bits 4           ",MULTI_EVENT,4U),
+    BENCH_MULTI("Multi-wait event bits 8           ",MULTI_EVENT,8U),
+    BENCH_MULTI("Multi-wait sem + flags 2          ",MULTI_SEM,2U),
+    BENCH_MULTI("Multi-wait sem + flags 4          ",MULTI_SEM,4U),
+    BENCH_MULTI("Multi-wait sem + flags 8          ",MULTI_SEM,8U),
+#if(configUSE_QUEUE_SETS==1)
+    BENCH_MULTI_ISR("ISR Multi-wait queue set 2        ",MULTI_SET,2U),
+    BENCH_MULTI_ISR("ISR Multi-wait queue set 4        ",MULTI_SET,4U),
+    BENCH_MULTI_ISR("ISR Multi-wait queue set 8        ",MULTI_SET,8U),
+#endif
+    BENCH_MULTI_ISR("ISR Multi-wait notify bits 2      ",MULTI_NOTIFY,2U),
+    BENCH_MULTI_ISR("ISR Multi-wait notify bits 4      ",MULTI_NOTIFY,4U),
+    BENCH_MULTI_ISR("ISR Multi-wait notify bits 8      ",MULTI_NOTIFY,8U),
+#if((configUSE_TIMERS==1)&&(INCLUDE_xTimerPendFunctionCall==1))
+    /* Every bit set from an interrupt takes a slot of the timer queue */
+    BENCH_MULTI_ISR("ISR Multi-wait event bits 2       ",MULTI_EVENT,2U),
+#if(configTIMER_QUEUE_LENGTH>=4)
+    BENCH_MULTI_ISR("ISR Multi-wait event bits 4       ",MULTI_EVENT,4U),
+#endif
+#if(configTIMER_QUEUE_LENGTH>=8)
+    BENCH_MULTI_ISR("ISR Multi-wait event bits 8       ",MULTI_EVENT,8U),
+#endif
+#endif
+    BENCH_MULTI_ISR("ISR Multi-wait sem + flags 2      ",MULTI_SEM,2U),
+    BENCH_MULTI_ISR("ISR Multi-wait sem + flags 4      ",MULTI_SEM,4U),
+    BENCH_MULTI_ISR("ISR Multi-wait sem + flags 8      ",MULTI_SEM,8U),
+    BENCH_PIPE("Pipeline queue, ISR to filter     ",PIPE_QUEUE,PIPE_LINK_FILTER),
+    BENCH_PIPE("Pipeline queue, filter to agg     ",PIPE_QUEUE,PIPE_LINK_AGG),
+    BENCH_PIPE("Pipeline queue, agg to logger     ",PIPE_QUEUE,PIPE_LINK_LOG),
+    BENCH_PIPE("Pipeline queue, end to end        ",PIPE_QUEUE,PIPE_TOTAL),
+    BENCH_PIPE("Pipeline notify, ISR to filter    ",PIPE_NOTIFY,PIPE_LINK_FILTER),
+    BENCH_PIPE("Pipeline notify, filter to agg    ",PIPE_NOTIFY,PIPE_LINK_AGG),
+    BENCH_PIPE("Pipeline notify, agg to logger    ",PIPE_NOTIFY,PIPE_LINK_LOG),
+    BENCH_PIPE("Pipeline notify, end to end       ",PIPE_NOTIFY,PIPE_TOTAL),
+    BENCH_PIPE("Pipeline mixed, ISR to filter     ",PIPE_MIXED,PIPE_LINK_FILTER),
+    BENCH_PIPE("Pipeline mixed, filter to agg     ",PIPE_MIXED,PIPE_LINK_AGG),
+    BENCH_PIPE("Pipeline mixed, agg to logger     ",PIPE_MIXED,PIPE_LINK_LOG),
+    BENCH_PIPE("Pipeline mixed, end to end        ",PIPE_MIXED,PIPE_TOTAL),
+    BENCH_PERIOD("Periodic harmonic 1T, release     ",PERIOD_HARMONIC,4U),
+    BENCH_PERIOD("Periodic non-harmonic 2T, release ",PERIOD_COPRIME,5U),
+};
+#define BENCH_NUM               (sizeof(Bench)/sizeof(Bench[0]))
+
+/* Whether each test is selected to run */
+uint8_t Bench_Sel[BENCH_NUM];
+
+/* Function:Bench_Select ******************************************************
+Description : Select the tests to run from a list of entry numbers, like
+              "0,2-4". An empty list selects all of them; anything that is not
+              a digit or a '-' separates the numbers.
+Input       : const char* List - The selection list.
+Output      : None.
+Return      : None.
+******************************************************************************/
+void Bench_Select(const char* List)
+{
+    uint32_t Count;
+    uint32_t Num;
+    uint32_t First;
+    uint32_t Digit;
+    uint32_t Range;
+    
+    for(Count=0U;Count<BENCH_NUM;Count++)
+        Bench_Sel[Count]=(List[0]=='\0')?1U:0U;
+    
+    Num=0U;
+    First=0U;
+    Digit=0U;
+    Range=0U;
+    for(Count=0U;;Count++)
+    {
+        if((List[Count]>='0')&&(List[Count]<='9'))
+        {
+            Num=Num*10U+(uint32_t)(List[Count]-'0');
+            Digit=1U;
+            continue;
+        }
+        
+        if((List[Count]=='-')&&(Digit!=0U))
+        {
+            First=Num;
+            Range=1U;
+        }
+        else if(Digit!=0U)
+        {
+            if(Range==0U)
+                First=Num;
+            for(;(First<=Num)&&(First<BENCH_NUM);First++)
+                Bench_Sel[First]=1U;
+            Range=0U;
+        }
+        
+        Num=0U;
+        Digit=0U;
+        if(List[Count]=='\0')
+            break;
+    }
+}
+/* End Function:Bench_Select *************************************************/
+
+#ifdef BENCH_CRIT
+/* Function:Crit_Enter ********************************************************
+Description : The critical section profiler, called by taskENTER_CRITICAL
+              through traceCRITICAL_ENTER. The outermost entry starts a masked
+              window, which is charged to its call site.
+Input       : const char* File - The file of the call site.
+              unsigned int Line - The line of the call site.
+Output      : None.
+Return      : None.
+******************************************************************************/
+void Crit_Enter(const char* File, unsigned int Line)
+{
+    if(Crit_Nest==0U)
+    {
+        Crit_File=File;
+        Crit_Line=Line;
+        Crit_Start=TEST_CNT_READ();
+    }
+    Crit_Nest++;
+}
+/* End Function:Crit_Enter ***************************************************/
+
+/* Function:Crit_Exit *********************************************************
+Description : The critical section profiler, called by taskEXIT_CRITICAL
+              through traceCRITICAL_EXIT. The outermost exit ends the masked
+              window and records it against its call site; the search is done
+              after the timestamp, so it is not charged to the window.
+Input       : None.
+Output      : None.
+Return      : None.
+******************************************************************************/
+void Crit_Exit(void)
+{
+    uint32_t Window;
+    uint32_t Count;
+    
+    /* Exits of sections entered before the tests started */
+    if(Crit_Nest==0U)
+        return;
+    Crit_Nest--;
+    if(Crit_Nest!=0U)
+        return;
+    
+    Window=(TEST_CNT_READ()-Crit_Start)&TEST_CNT_MASK;
+    for(Count=0U;Count<Crit_Site_Num;Count++)
+    {
+        if((Crit_Site[Count].File==Crit_File)&&(Crit_Site[Count].Line==Crit_Line))
+            break;
+    }
+    if(Count==Crit_Site_Num)
+    {
+        if(Crit_Site_Num==CRIT_SITE_NUM)
+        {
+            Crit_Lost++;
+            return;
+        }
+        Crit_Site[Count].File=Crit_File;
+        Crit_Site[Count].Line=Crit_Line;
+        Crit_Site[Count].Max=0U;
+        Crit_Site[Count].Count=0U;
+        Crit_Site_Num++;
+    }
+    Crit_Site[Count].Count++;
+    if(Window>Crit_Site[Count].Max)
+        Crit_Site[Count].Max=Window;
+}
+/* End Function:Crit_Exit ****************************************************/
+
+/* Function:Crit_Print ********************************************************
+Description : Print the longest masked window of every call site seen since
+              the tests started, longest first. The scheduler is kept
+              suspended, so that no other task adds to the table while it is
+              sorted in place.
+Input       : None.
+Output      : None.
+Return      : None.
+******************************************************************************/
+void Crit_Print(void)
+{
+    uint32_t Count;
+    uint32_t Pick;
+    uint32_t Len;
+    uint32_t Digit;
+    const char* Name;
+    struct Crit_Site_Struct Site;
+    
+    vTaskSuspendAll();
+    Print_Str("Masked window by call site         : MAX / COUNT\r\n");
+    for(Count=0U;Count<Crit_Site_Num;Count++)
+    {
+        Pick=Count;
+        for(Len=Count+1U;Len<Crit_Site_Num;Len++)
+        {
+            if(Crit_Site[Len].Max>Crit_Site[Pick].Max)
+                Pick=Len;
+        }
+        Site=Crit_Site[Pick];
+        Crit_Site[Pick]=Crit_Site[Count];
+        Crit_Site[Count]=Site;
+        
+        /* Drop the directory, and pad to the result column */
+        Name=Site.File;
+        for(Len=0U;Site.File[Len]!='\0';Len++)
+        {
+            if((Site.File[Len]=='/')||(Site.File[Len]=='\\'))
+                Name=&Site.File[Len+1U];
+        }
+        Print_Str("    ");
+        Print_Str(Name);
+        Print_Str(":");
+        Print_Int(Site.Line);
+        Len=5U;
+        while(Name[Len-5U]!='\0')
+            Len++;
+        Digit=Site.Line;
+        do
+        {
+            Len++;
+            Digit/=10U;
+        }
+        while(Digit!=0U);
+        for(;Len<35U;Len++)
+            Print_Str(" ");
+        Print_Str(": ");
+        Print_Int(Site.Max);
+        Print_Str(" / ");
+        Print_Int(Site.Count);
+        Print_Str("\r\n");
+    }
+    if(Crit_Lost!=0U)
+    {
+        Print_Str("    Windows of untracked sites    : ");
+        Print_Int(Crit_Lost);
+        Print_Str("\r\n");
+    }
+    xTaskResumeAll();
+}
+/* End Function:Crit_Print ***************************************************/
+#endif
+
+#ifdef BENCH_STORM
+/* Function:Storm_Print *******************************************************
+Description : Print how many interrupts each storm source raised during the
+              storm run, to tell whether the board kept up with the rates.
+Input       : None.
+Output      : None.
+Return      : None.
+******************************************************************************/
+void Storm_Print(void)
+{
+    Print_Str("Storm interrupts above kernel      : ");
+    Print_Int(Storm_Count[STORM_RAW]);
+    Print_Str(" @ ");
+    Print_Int(BENCH_STORM_HZ_RAW);
+    Print_Str("Hz\r\n");
+    Print_Str("Storm interrupts calling kernel    : ");
+    Print_Int(Storm_Count[STORM_API]);
+    Print_Str(" @ ");
+    Print_Int(BENCH_STORM_HZ_API);
+    Print_Str("Hz\r\n");
+}
+/* End Function:Storm_Print **************************************************/
+#endif
+
+#ifdef BENCH_TRACE
+/* Function:Trace_Malloc ******************************************************
+Description : The allocation tracer, called by pvPortMalloc through
+              traceMALLOC. The heaps call it with the scheduler suspended, so
+              the ring needs no other protection. Tasks are numbered in the
+              order they first allocate, from 1; 0 is before the scheduler.
+Input       : void* Addr - The block returned, or NULL.
+              unsigned int Size - The size the heap looked for.
+              void* Site - The return address of pvPortMalloc.
+Output      : None.
+Return      : None.
+******************************************************************************/
+uint32_t Trace_Task_Get(void)
+{
+    TaskHandle_t Task;
+    uint32_t Count;
+    
+    /* The handle is that of the last task made until the scheduler starts */
+    if(xTaskGetSchedulerState()==taskSCHEDULER_NOT_STARTED)
+        return 0U;
+    Task=xTaskGetCurrentTaskHandle();
+    for(Count=0U;Count<Trace_Task_Num;Count++)
+    {
+        if(Trace_Task[Count]==Task)
+            return Count+1U;
+    }
+    if(Trace_Task_Num==TRACE_TASK_NUM-1U)
+        return TRACE_TASK_NUM;
+    Trace_Task[Trace_Task_Num]=Task;
+    Trace_Task_Num++;
+    return Trace_Task_Num;
+}
+
+void Trace_Record(void* Addr, uint32_t Info, void* Site)
+{
+    struct Trace_Struct* Rec;
+    
+    Rec=&Trace_Buf[Trace_Total%BENCH_TRACE_NUM];
+    Rec->Tick=(uint32_t)xTaskGetTickCount();
+    Rec->Site=(uint32_t)(size_t)Site;
+    Rec->Addr=(uint32_t)(size_t)Addr;
+    Rec->Info=Info;
+    Trace_Total++;
+}
+
+void Trace_Malloc(void* Addr, unsigned int Size, void* Site)
+{
+    Trace_Record(Addr,TRACE_INFO(Size,Trace_Task_Get()),Site);
+}
+/* End Function:Trace_Malloc *************************************************/
+
+/* Function:Trace_Free ********************************************************
+Description : The allocation tracer, called by vPortFree through traceFREE.
+Input       : void* Addr - The block freed.
+              void* Site - The return address of vPortFree.
+Output      : None.
+Return      : None.
+******************************************************************************/
+void Trace_Free(void* Addr, void* Site)
+{
+    Trace_Record(Addr,TRACE_INFO(0U,Trace_Task_Get())|TRACE_FREE,Site);
+}
+/* End Function:Trace_Free ***************************************************/
+
+/* Function:Trace_Print *******************************************************
+Description : Dump the allocation trace, oldest record first, for the replay
+              in Tools/Replay. The heading tells the heap and the header size
+              that the malloc sizes include, and each record is printed as
+              its four words in hex: tick, call site, address and info.
+Input       : None.
+Output      : None.
+Return      : None.
+******************************************************************************/
+void Trace_Print(void)
+{
+    uint32_t Count;
+    uint32_t First;
+    uint32_t Num;
+    struct Trace_Struct* Rec;
+    
+    /* Nothing may allocate while the ring is printed */
+    vTaskSuspendAll();
+    Num=(Trace_Total<BENCH_TRACE_NUM)?Trace_Total:BENCH_TRACE_NUM;
+    First=Trace_Total-Num;
+    Print_Str("Allocation trace                   : ");
+    Print_Int(Num);
+    Print_Str(" records of ");
+    Print_Int(Trace_Total);
+    Print_Str(", heap_");
+    Print_Int(BENCH_HEAP);
+    Print_Str(", header ");
+    Print_Int(TRACE_HEADER);
+    Print_Str("\r\n");
+    for(Count=0U;Count<Num;Count++)
+    {
+        Rec=&Trace_Buf[(First+Count)%BENCH_TRACE_NUM];
+        Print_Str("T:");
+        Hex_Print(Rec->Tick);
+        Print_Str(" ");
+        Hex_Print(Rec->Site);
+        Print_Str(" ");
+        Hex_Print(Rec->Addr);
+        Print_Str(" ");
+        Hex_Print(Rec->Info);
+        Print_Str("\r\n");
+    }
+    Print_Str("Allocation trace end\r\n");
+    (void)xTaskResumeAll();
+}
+/* End Function:Trace_Print **************************************************/
+#endif
+
+#ifdef BENCH_CONSOLE
+/* Function:Bench_Prompt ******************************************************
+Description : List the tests on the console and read the selection from it.
+              Only for boards whose test.h provides GETCHAR().
+Input       : None.
+Output      : None.
+Return      : None.
+******************************************************************************/
+void Bench_Prompt(void)
+{
+    uint32_t Count;
+    char Line[32];
+    
+    for(Count=0U;Count<BENCH_NUM;Count++)
+    {
+        Print_Str("  ");
+        Print_Int(Count);
+        Print_Str(" : ");
+        Print_Str(Bench[Count].Name);
+        Print_Str("\r\n");
+    }
+    Print_Str("Select tests (e.g. 0,2-4, empty for all): ");
+    
+    for(Count=0U;Count<(sizeof(Line)-1U);Count++)
+    {
+        Line[Count]=(char)GETCHAR();
+        if((Line[Count]=='\r')||(Line[Count]=='\n'))
+            break;
+    }
+    Line[Count]='\0';
+    Print_Str("\r\n");
+    
+    Bench_Select(Line);
+}
+/* End Function:Bench_Prompt *************************************************/
+#endif
+
+/* Function:Cache_Evict *******************************************************
+Description : Leave the caches cold for the next round of a cold cache run.
+              The board flushes what it can, and the eviction buffer, if any,
+              is read through one line at a time to push the rest out.
+Input       : None.
+Output      : None.
+Return      : None.
+******************************************************************************/
+void Cache_Evict(void)
+{
+#if(defined(BENCH_COLD)&&(BENCH_EVICT_SIZE>0U))
+    uint32_t Count;
+    
+    for(Count=0U;Count<BENCH_EVICT_SIZE;Count+=EVICT_LINE)
+        Evict_Sum+=Evict_Buf[Count];
+#endif
+    Cache_Flush();
+}
+/* End Function:Cache_Evict **************************************************/
+
+/* Function:Bench_Run *********************************************************
+Description : Run one test and print its result. This is called by the
+              receiver task; the sender task and the periodic interrupt are
+              started as the test needs them.
+Input       : const struct Bench_Struct* Test - The test.
+Output      : None.
+Return      : None.
+******************************************************************************/
+void Bench_Run(const struct Bench_Struct* Test)
+{
+    uint32_t Count;
+    
+    Bench_Cur=Test;
+    Flip=0U;
+    /* The receiver starts out at the bottom, and the helpers made by the
+     * setup must not get to run before it unless it lets them */
+    vTaskPrioritySet(Thd_2,2U);
+    if(Test->Setup!=NULL)
+        Test->Setup();
+    
+    /* The receiver is above the sender and the interrupt's victim, except in
+     * the tests where the two take turns at the same priority */
+    vTaskPrioritySet(Thd_2,(Test->Mode==BENCH_SAME)?1U:2U);
+    
+    TEST_INIT();
+    if(Test->Sender!=NULL)
+        xSemaphoreGive(Sem_Go);
+    if(Test->Mode==BENCH_ISR)
+    {
+        Int_Count=0U;
+        Int_Init();
+    }
+    
+    for(Count=0U;Count<Test->Rounds;Count++)
+    {
+        if(Bench_Cold!=0U)
+            Cache_Evict();
+        Test->Receiver(Count);
+    }
+    
+    if(Test->Mode==BENCH_ISR)
+        Int_Disable();
+    /* Let the sender leave its last round */
+    if(Test->Sender!=NULL)
+        xSemaphoreTake(Sem_Done,portMAX_DELAY);
+    
+    /* Tests that do several operations per sample report per operation */
+    if(Test->Div>1U)
+    {
+        Total/=Test->Div;
+        Sq_Total/=Test->Div*Test->Div;
+        Max/=Test->Div;
+        Min/=Test->Div;
+        Hist->Div=Test->Div;
+    }
+    
+    TEST_LIST(Test->Name);
+    
+    /* This comes after the result, so that it may print figures derived
+     * from it */
+    if(Test->Teardown!=NULL)
+        Test->Teardown();
+}
+/* End Function:Bench_Run ****************************************************/
+
+/* Function:Func_1 ************************************************************
+Description : The sender task. It starts the tests, and then runs the sender
+              side of every test that has one.
+Input       : None.
+Output      : None.
+Return      : None.
+******************************************************************************/
+void Func_1(void* pvParameters)
+{
+    uint32_t Count;
+    const struct Bench_Struct* Test;
+    
+    /* Make sure to disable the tick timer completely. */
+    Tick_Disable();
+    
+    /* Measure the counter read cost before any test runs */
+    Overhead=Test_Overhead();
+    Print_Str("Counter read overhead (subtracted) : ");
+    Print_Int(Overhead);
+    Print_Str("\r\n");
+    
+    Bench_Select(BENCH_SELECT);
+#ifdef BENCH_CONSOLE
+    Bench_Prompt();
+#endif
+    
+    Print_Str("Test (number in CPU cycles)        : AVG / MAX / MIN\r\n");
+    /* Let the receiver task start running the tests */
+    vTaskPrioritySet(Thd_1,1U);
+    
+    while(1)
+    {
+        xSemaphoreTake(Sem_Go,portMAX_DELAY);
+        Test=Bench_Cur;
+        for(Count=0U;Count<Test->Rounds;Count++)
+            Test->Sender(Count);
+        xSemaphoreGive(Sem_Done);
+    }
+}
+/* End Function:Func_1 *******************************************************/
+
+/* Function:Func_2 ************************************************************
+Description : The receiver task, which runs the selected tests in order.
+Input       : None.
+Output      : None.
+Return      : None.
+******************************************************************************/
+void Func_2(void* pvParameters)
+{
+    uint32_t Count;
+    
+#ifdef BENCH_CRIT
+    /* Only profile the tests, not the startup */
+    taskENTER_CRITICAL();
+    Crit_Site_Num=0U;
+    Crit_Lost=0U;
+    taskEXIT_CRITICAL();
+#endif
+    for(Count=0U;Count<BENCH_NUM;Count++)
+    {
+        if(Bench_Sel[Count]!=0U)
+            Bench_Run(&Bench[Count]);
+    }
+#ifdef BENCH_COLD
+    /* The same tests again, with nothing of them left in the caches */
+    Print_Str("Cold cache, flushed every round    : AVG / MAX / MIN\r\n");
+    Bench_Cold=1U;
+    for(Count=0U;Count<BENCH_NUM;Count++)
+    {
+        if(Bench_Sel[Count]!=0U)
+            Bench_Run(&Bench[Count]);
+    }
+    Bench_Cold=0U;
+#endif
+#ifdef BENCH_STORM
+    /* The same tests again, with the other interrupt sources firing */
+    Print_Str("Interrupt storm                    : AVG / MAX / MIN\r\n");
+    Storm_Count[STORM_RAW]=0U;
+    Storm_Count[STORM_API]=0U;
+    Bench_Storm=1U;
+    Storm_Init(BENCH_STORM_HZ_RAW,BENCH_STORM_HZ_API);
+    for(Count=0U;Count<BENCH_NUM;Count++)
+    {
+        if(Bench_Sel[Count]!=0U)
+            Bench_Run(&Bench[Count]);
+    }
+    Storm_Disable();
+    Bench_Storm=0U;
+    Storm_Print();
+#endif
+#ifdef BENCH_CRIT
+    Crit_Print();
+#endif
+#ifdef BENCH_TRACE
+    Trace_Print();
+#endif
+    
+    /* Test stop - Decide whether to exit, or keep dumping counter values
+     * to detect potentially wrong timer clock rate configurations */
+#ifdef TEST_EXIT
+    Test_Exit();
+#else
+    while(1)
+    {
+        Start=End;
+        End=(uint16_t)TEST_CNT_READ();
+        if(Start>End)
+        {
+            Overflow++;
+            if((Overflow%OVERFLOW_NUM)==0U)
+            {
+                Print_Int(OVERFLOW_NUM);
+                Print_Str(" overflows\r\n");
+            }
+        }
+    }
+#endif
+}
+/* End Function:Func_2 *******************************************************/
+
+/* Function:Int_Handler *******************************************************
+Description : The interrupt handler. Call this in your periodic ISR.
+Input       : None.
+Output      : None.
+Return      : None.
+******************************************************************************/
+void Int_Handler(void)
+{
+    if(Flip!=0U)
+        Print_Str("Interrupt reentered.\r\n");
+    
+    Flip=1U;
+    
+    if(Int_Count<Bench_Cur->Rounds)
+    {
+        Int_Count++;
+        Bench_Cur->ISR();
+    }
+    else
+        Int_Disable();
+}
+/* End Function:Int_Handler **************************************************/
+
+#ifdef BENCH_STORM
+/* Function:Storm_Handler *****************************************************
+Description : The interrupt storm handlers. Call these in the ISRs of the two
+              storm sources. The source above the kernel may not call into
+              it, so it only does a fixed amount of work, as a control loop
+              would; the other one publishes a value through a queue that
+              nobody waits on, so it takes the kernel's ISR critical sections
+              but never wakes a task and leaves the tests alone otherwise.
+Input       : None.
+Output      : None.
+Return      : None.
+******************************************************************************/
+void Storm_Raw_Handler(void)
+{
+    uint32_t Count;
+    
+    Storm_Count[STORM_RAW]++;
+    for(Count=0U;Count<BENCH_STORM_WORK;Count++)
+        Storm_Sum+=Count;
+}
+
+void Storm_Api_Handler(void)
+{
+    BaseType_t Task_Woke=pdFALSE;
+    
+    Storm_Count[STORM_API]++;
+    xQueueOverwriteFromISR(Queue_Storm,(const void*)&Storm_Count[STORM_API],&Task_Woke);
+    portYIELD_FROM_ISR(Task_Woke);
+}
+/* End Function:Storm_Handler ************************************************/
+#endif
+
+/* Function:main **************************************************************
+Description : The entry of the FreeRTOS.
+Input       : None.
+Output      : None.
+Return      : int - This function never returns.
+******************************************************************************/
+int main()
+{
+    Low_Lvl_Init();
+    
+    /* Initialize timer 2 */
+    Timer_Init();
+    
+#if(BENCH_HEAP==5U)
+    /* heap_5 needs its regions before the first allocation */
+    vPortDefineHeapRegions(Heap_Region);
+#endif
+    
+    /* Create kernel objects */
+    Sem_1=xSemaphoreCreateCounting(SEM_CNT_MAX,0U);
+    Queue_1=xQueueCreate(QUEUE_LENGTH,QUEUE_ITEM_SIZE);
+    Mutex_1=xSemaphoreCreateMutex();
+    Mutex_Rec=xSemaphoreCreateRecursiveMutex();
+    Timer_1=xTimerCreate("Timer1",TIMER_IDLE_PERIOD,pdFALSE,NULL,Timer_Callback);
+    Timer_Once=xTimerCreate("Once",1U,pdFALSE,NULL,Timer_Callback);
+    Timer_Auto=xTimerCreate("Auto",1U,pdTRUE,NULL,Timer_Callback);
+    Sem_Scale=xSemaphoreCreateBinary();
+    Sem_Pend=xSemaphoreCreateCounting(BENCH_HELPER_NUM,0U);
+    Queue_Thru=xQueueCreate(THRU_QUEUE_LEN,sizeof(uint32_t));
+    Sem_Thru=xSemaphoreCreateCounting(THRU_TOTAL,0U);
+#ifdef BENCH_STORM
+    Queue_Storm=xQueueCreate(1U,sizeof(uint32_t));
+#endif
+    Event_1=xEventGroupCreate();
+    Event_Sync=xEventGroupCreate();
+    Sem_Go=xSemaphoreCreateBinary();
+    Sem_Done=xSemaphoreCreateBinary();
+    
+    Print_Str("====================================================\r\n");
+
+    xTaskCreate(Func_2,
+                "Func2",
+                256,
+                (void*)0x4321U,
+                1U,
+                &Thd_2);
+
+    xTaskCreate(Func_1,
+                "Func1",
+                256,
+                (void*)0x1234U,
+                2U,
+                &Thd_1);
+
+    vTaskStartScheduler();
+}
+/* End Function:main *********************************************************/
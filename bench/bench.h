@@ -0,0 +1,101 @@
+/******************************************************************************
+Filename    : bench.h
+Author      : hrs
+Date        : 17/10/2026
+Licence     : The Unlicense; see LICENSE for details.
+Description : The board interface of the benchmark core. Each board has a
+              test.h that provides the following, and bench.c knows nothing
+              else about the board.
+
+              Timestamp
+              TEST_CNT_READ()    - Read the free-running cycle counter.
+              TEST_CNT_MASK      - The valid counter bits, if less than 32.
+              Timer_Init()       - Start the counter.
+              Tick_Disable()     - Stop the kernel tick for good.
+
+              Periodic interrupt
+              Int_Init()         - Start the periodic interrupt, which calls
+                                   Int_Handler() every time. Called again for
+                                   every interrupt test.
+              Int_Disable()      - Stop it. Safe to call from Int_Handler().
+              TEST_INT_LATENCY() - Cycles since the interrupt was raised, from
+                                   the timer that raised it. Optional, for
+                                   the ISR phase breakdown.
+
+              Interrupt storm, for BENCH_STORM only
+              TEST_STORM         - Defined if the board has the following.
+              Storm_Init(RAW,API) - Start two more periodic interrupts at
+                                   RAW and API Hz. The first is above
+                                   configMAX_SYSCALL_INTERRUPT_PRIORITY and
+                                   calls Storm_Raw_Handler(); the second is
+                                   at or below it, but above the periodic
+                                   interrupt, and calls Storm_Api_Handler().
+              Storm_Disable()    - Stop both.
+
+              Console
+              PUTCHAR(CHAR)      - Write a character, busy-waiting.
+              Print_Int/Print_Str - Write a number or a string.
+              GETCHAR()          - Read a character, blocking. Optional, only
+                                   needed for BENCH_CONSOLE.
+
+              Cache control
+              Cache_Flush()      - Write back and invalidate every cache and
+                                   flash accelerator the chip has.
+              BENCH_EVICT_SIZE   - Bytes to read through as well, for caches
+                                   that cannot be flushed. Optional.
+
+              Board
+              TEST_BOARD         - The board name in the structured output.
+              Low_Lvl_Init()     - Set up clocks, caches and the console.
+              TEST_EXIT          - Call Test_Exit() when done. Optional.
+              TEST_MEM_POOL_NONE - Skip the memory pool test. Optional.
+              HIST_VAL_BITS      - Shrink the histograms. Optional.
+              BENCH_HELPER_NUM   - Fewer helper tasks. Optional.
+              BENCH_TIMER_NUM    - Fewer active timers. Optional.
+              BENCH_TRACE_NUM    - A shorter allocation trace. Optional.
+******************************************************************************/
+
+/* Define ********************************************************************/
+#ifndef __BENCH_H__
+#define __BENCH_H__
+/* End Define ****************************************************************/
+
+/* Global ********************************************************************/
+void Low_Lvl_Init(void);
+void Timer_Init(void);
+void Tick_Disable(void);
+void Int_Init(void);
+void Int_Disable(void);
+void Cache_Flush(void);
+int Int_Print(int Int);
+int Str_Print(const signed char* String);
+#ifdef TEST_EXIT
+void Test_Exit(void);
+#endif
+#ifdef TEST_STORM
+void Storm_Init(uint32_t Raw_Hz, uint32_t Api_Hz);
+void Storm_Disable(void);
+#endif
+
+/* Provided by the core, for the periodic interrupt */
+void Int_Handler(void);
+/* Provided by the core, for the storm interrupts when BENCH_STORM is on */
+void Storm_Raw_Handler(void);
+void Storm_Api_Handler(void);
+/* Provided by the core, for traceTASK_SWITCHED_IN when BENCH_PHASE is on */
+void Phase_Switch_Mark(void);
+/* Provided by the core, for traceCRITICAL_ENTER/EXIT when BENCH_CRIT is on */
+void Crit_Enter(const char* File, unsigned int Line);
+void Crit_Exit(void);
+/* Provided by the core, for traceMALLOC/traceFREE when BENCH_TRACE is on */
+void Trace_Malloc(void* Addr, unsigned int Size, void* Site);
+void Trace_Free(void* Addr, void* Site);
+/* End Global ****************************************************************/
+
+/* Define ********************************************************************/
+#endif /* __BENCH_H__ */
+/* End Define ****************************************************************/
+
+/* End Of File ***************************************************************/
+
+/* Copyright (C) Evo-Devo Instrum. All rights reserved ***********************/
@@ -1,3 +1,7 @@
+cd GCCMF-HOST && make clean
+cd ..
+cd GCCMF-QEMU && make clean
+cd ..
 cd GCCMF-STM32F405 && make clean
 cd ..
 cd GCCMF-STM32F767 && make clean